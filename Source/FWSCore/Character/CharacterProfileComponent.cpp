@@ -1,7 +1,7 @@
 ﻿#include "CharacterProfileComponent.h"
 #include "FWSCore/Systems/PlayerProfile/PlayerProfileSubsystem.h"
+#include "FWSCore/Systems/Save/SaveSystemSubsystem.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 
 UCharacterProfileComponent::UCharacterProfileComponent()
 {
@@ -101,22 +101,43 @@ void UCharacterProfileComponent::SaveNow()
 {
 	if (auto* S = PPS())
 	{
-		S->SaveCharacter(Profile); // ignore bool; not needed for timer
+		bProfileDirty = false;
+		S->SaveCharacter(Profile); // ignore bool
 	}
 }
 
 void UCharacterProfileComponent::MarkDirtyAndAutosave()
 {
-	if (UWorld* W = GetWorld())
+	// Only flag it: the save scheduler merges this request with every other pending one, and the profile
+	// is written into the save object once, when that save starts.
+	bProfileDirty = true;
+	USaveSystemSubsystem* Save = PPS() ? PPS()->GetSave() : nullptr;
+	if (!Save) return;
+
+	if (!Save->OnSaveStarted.IsAlreadyBound(this, &UCharacterProfileComponent::HandleSaveStarted))
 	{
-		if (AutosaveHandle.IsValid())
-		{
-			W->GetTimerManager().ClearTimer(AutosaveHandle);
-		}
-		W->GetTimerManager().SetTimer(
-			AutosaveHandle,
-			this, &UCharacterProfileComponent::SaveNow,
-			1.0f, /*bLoop=*/false
-		);
+		Save->OnSaveStarted.AddDynamic(this, &UCharacterProfileComponent::HandleSaveStarted);
+	}
+	Save->RequestSave(true);
+}
+
+void UCharacterProfileComponent::HandleSaveStarted(FString SlotName)
+{
+	if (!bProfileDirty) return;
+	if (auto* S = PPS())
+	{
+		bProfileDirty = false;
+		S->StageCharacter(Profile); // ignore bool
+	}
+}
+
+void UCharacterProfileComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Still-unwritten changes go into the save object; the pending request writes them out.
+	HandleSaveStarted(FString());
+	if (USaveSystemSubsystem* Save = PPS() ? PPS()->GetSave() : nullptr)
+	{
+		Save->OnSaveStarted.RemoveAll(this);
 	}
+	Super::EndPlay(EndPlayReason);
 }
@@ -41,6 +41,7 @@ public:
 
 protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	UPROPERTY(Transient) FCharacterProfile Profile;
@@ -53,5 +54,10 @@ private:
 	void RebuildSummary();
 	UPlayerProfileSubsystem* PPS() const;
 	void MarkDirtyAndAutosave();
-	FTimerHandle AutosaveHandle;
+
+	/** Profile changed since it was last written into the save object. */
+	bool bProfileDirty = false;
+
+	/** Writes the profile into the save object once per scheduled save, however many mutations it batches. */
+	UFUNCTION() void HandleSaveStarted(FString SlotName);
 };
@@ -18,29 +18,23 @@ namespace
 }
 
 // ---------- small helpers ----------
-static bool ReadFloat(USaveSystemSubsystem* S, const FName ObjectId, const FName Key, float& Out)
+static bool ReadFloat(USaveSystem* S, const FName ObjectId, const FName Key, float& Out)
 {
-	FString Str;
-	if (!S || !S->GetCurrentSaveSystem()->GetField(ObjectId, Key, Str)) return false;
-	Out = FCString::Atof(*Str);
-	return true;
+	return S && S->GetFloat(ObjectId, Key, Out);
 }
-static bool ReadBool(USaveSystemSubsystem* S, const FName ObjectId, const FName Key, bool& Out)
+static bool ReadBool(USaveSystem* S, const FName ObjectId, const FName Key, bool& Out)
 {
-	FString Str;
-	if (!S || !S->GetCurrentSaveSystem()->GetField(ObjectId, Key, Str)) return false;
-	Out = (Str == TEXT("1") || Str.Equals(TEXT("true"), ESearchCase::IgnoreCase));
-	return true;
+	return S && S->GetBool(ObjectId, Key, Out);
 }
-static void WriteFloat(USaveSystemSubsystem* S, const FName ObjectId, const FName Key, float Val)
+static void WriteFloat(USaveSystem* S, const FName ObjectId, const FName Key, float Val)
 {
 	if (!S) return;
-	S->GetCurrentSaveSystem()->SetField(ObjectId, Key, FString::SanitizeFloat(Val));
+	S->SetFloat(ObjectId, Key, Val);
 }
-static void WriteBool(USaveSystemSubsystem* S, const FName ObjectId, const FName Key, bool Val)
+static void WriteBool(USaveSystem* S, const FName ObjectId, const FName Key, bool Val)
 {
 	if (!S) return;
-	S->GetCurrentSaveSystem()->SetField(ObjectId, Key, Val ? TEXT("1") : TEXT("0"));
+	S->SetBool(ObjectId, Key, Val);
 }
 
 // ---------- component ----------
@@ -82,40 +76,42 @@ void UPlayerProfileComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void UPlayerProfileComponent::SetProfileMeta(FName Key, const FString& Value)
 {
-	if (USaveSystemSubsystem* Save = GetSaveSystem())
+	USaveSystemSubsystem* Save = GetSaveSystem();
+	if (USaveSystem* SaveObj = GetProfileSave())
 	{
-		Save->GetCurrentSaveSystem()->SetField(PROFILE_OBJECT_ID, Key, Value);
+		SaveObj->SetField(PROFILE_OBJECT_ID, Key, Value);
 
 		if (Key == TEXT("DisplayName")) CachedMeta.DisplayName = Value;
 		else if (Key == TEXT("PUID"))   CachedMeta.PUID        = Value;
 		else if (Key == TEXT("EAS"))    CachedMeta.EAS         = Value;
 
 		BroadcastMetaSnapshot();
-		Save->RequestSave(false);
+		Save->RequestSaveForPlayer(CurrentKey.LocalUserNum, false, ESavePriority::High);
 	}
 }
 
 void UPlayerProfileComponent::SetProfileMetaMap(const TMap<FName,FString>& Map)
 {
-	if (USaveSystemSubsystem* Save = GetSaveSystem())
+	USaveSystemSubsystem* Save = GetSaveSystem();
+	if (USaveSystem* SaveObj = GetProfileSave())
 	{
 		for (const auto& Kvp : Map)
 		{
-			Save->GetCurrentSaveSystem()->SetField(PROFILE_OBJECT_ID, Kvp.Key, Kvp.Value);
+			SaveObj->SetField(PROFILE_OBJECT_ID, Kvp.Key, Kvp.Value);
 			if (Kvp.Key == TEXT("DisplayName")) CachedMeta.DisplayName = Kvp.Value;
 			else if (Kvp.Key == TEXT("PUID"))   CachedMeta.PUID        = Kvp.Value;
 			else if (Kvp.Key == TEXT("EAS"))    CachedMeta.EAS         = Kvp.Value;
 		}
 		BroadcastMetaSnapshot();
-		Save->RequestSave(false);
+		Save->RequestSaveForPlayer(CurrentKey.LocalUserNum, false, ESavePriority::High);
 	}
 }
 
 bool UPlayerProfileComponent::GetProfileMeta(FName Key, FString& OutValue) const
 {
-	if (USaveSystemSubsystem* Save = GetSaveSystem())
+	if (USaveSystem* SaveObj = GetProfileSave())
 	{
-		return Save->GetCurrentSaveSystem()->GetField(PROFILE_OBJECT_ID, Key, OutValue);
+		return SaveObj->GetField(PROFILE_OBJECT_ID, Key, OutValue);
 	}
 	return false;
 }
@@ -123,7 +119,7 @@ bool UPlayerProfileComponent::GetProfileMeta(FName Key, FString& OutValue) const
 FPlayerProfileMeta UPlayerProfileComponent::GetProfileMetaSnapshot() const
 {
 	FPlayerProfileMeta Meta;
-	if (USaveSystem* Save = GetSaveSystem()->GetCurrentSaveSystem())
+	if (USaveSystem* Save = GetProfileSave())
 	{
 		FString Val;
 		if (Save->GetField(PROFILE_OBJECT_ID, TEXT("DisplayName"), Val)) Meta.KV.Add(TEXT("DisplayName"), Val);
@@ -147,11 +143,8 @@ void UPlayerProfileComponent::InitializeProfile(bool bApplyAfterLoad)
 	}
 
 	RefreshDisplayName();
-	MountResolvedProfile();              // ensures correct slot & meta in save system
-
-	bool bFound = false;
-	LoadSettings(bFound);
-	if (bApplyAfterLoad) { ApplySettings(); }
+	bApplyAfterMount = bApplyAfterLoad;
+	MountResolvedProfile();              // ensures correct slot & meta in save system; then loads settings
 }
 
 void UPlayerProfileComponent::RefreshFromActiveIdentity(bool bApplyAfterLoad)
@@ -180,27 +173,27 @@ void UPlayerProfileComponent::LoadSettings(bool& bFound)
 {
 	bFound = false;
 
-	if (USaveSystemSubsystem* Save = GetSaveSystem())
+	if (USaveSystem* SaveObj = GetProfileSave())
 	{
 		FPlayerSettings S = CurrentSettings; // start from whatever defaults you ship
 
 		bool any = false;
-		any |= ReadFloat(Save, SETTINGS_OBJECT_ID, TEXT("MasterVolume"),     S.MasterVolume);
-		any |= ReadFloat(Save, SETTINGS_OBJECT_ID, TEXT("SFXVolume"),        S.SFXVolume);
-		any |= ReadFloat(Save, SETTINGS_OBJECT_ID, TEXT("MusicVolume"),      S.MusicVolume);
-		any |= ReadFloat(Save, SETTINGS_OBJECT_ID, TEXT("FieldOfView"),      S.FieldOfView);
-		any |= ReadFloat(Save, SETTINGS_OBJECT_ID, TEXT("MouseSensitivity"), S.MouseSensitivity);
-		any |= ReadBool (Save, SETTINGS_OBJECT_ID, TEXT("bVSync"),           S.bVSync);
-		any |= ReadBool (Save, SETTINGS_OBJECT_ID, TEXT("bInvertY"),         S.bInvertY);
+		any |= ReadFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("MasterVolume"),     S.MasterVolume);
+		any |= ReadFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("SFXVolume"),        S.SFXVolume);
+		any |= ReadFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("MusicVolume"),      S.MusicVolume);
+		any |= ReadFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("FieldOfView"),      S.FieldOfView);
+		any |= ReadFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("MouseSensitivity"), S.MouseSensitivity);
+		any |= ReadBool (SaveObj, SETTINGS_OBJECT_ID, TEXT("bVSync"),           S.bVSync);
+		any |= ReadBool (SaveObj, SETTINGS_OBJECT_ID, TEXT("bInvertY"),         S.bInvertY);
 
 		// Optional fields
 		{
 			FString Str;
-			if (Save->GetCurrentSaveSystem()->GetField(SETTINGS_OBJECT_ID, TEXT("PreferredDisplayName"), Str)) { S.PreferredDisplayName = Str; any = true; }
-			if (Save->GetCurrentSaveSystem()->GetField(SETTINGS_OBJECT_ID, TEXT("ChosenAvatarId"),       Str)) { S.ChosenAvatarId       = Str; any = true; }
-			if (Save->GetCurrentSaveSystem()->GetField(SETTINGS_OBJECT_ID, TEXT("ThemeId"),              Str)) { S.ThemeId = FName(*Str);      any = true; }
-			if (Save->GetCurrentSaveSystem()->GetField(SETTINGS_OBJECT_ID, TEXT("QualityPreset"),        Str)) { S.QualityPreset = FCString::Atoi(*Str); any = true; }
-			if (Save->GetCurrentSaveSystem()->GetField(SETTINGS_OBJECT_ID, TEXT("Version"),              Str)) { S.Version = FCString::Atoi(*Str); any = true; }
+			if (SaveObj->GetField(SETTINGS_OBJECT_ID, TEXT("PreferredDisplayName"), Str)) { S.PreferredDisplayName = Str; any = true; }
+			if (SaveObj->GetField(SETTINGS_OBJECT_ID, TEXT("ChosenAvatarId"),       Str)) { S.ChosenAvatarId       = Str; any = true; }
+			any |= SaveObj->GetName(SETTINGS_OBJECT_ID, TEXT("ThemeId"),       S.ThemeId);
+			any |= SaveObj->GetInt (SETTINGS_OBJECT_ID, TEXT("QualityPreset"), S.QualityPreset);
+			any |= SaveObj->GetInt (SETTINGS_OBJECT_ID, TEXT("Version"),       S.Version);
 		}
 
 		ClampAndMigrate(S);
@@ -237,12 +230,15 @@ void UPlayerProfileComponent::ApplyCameraAndInput(const FPlayerSettings& S)
 {
 	if (UWorld* W = GetWorld())
 	{
-		if (APlayerController* PC = UGameplayStatics::GetPlayerController(W, 0))
+		// The owning controller: in split-screen each player applies to their own camera.
+		APlayerController* PC = Cast<APlayerController>(GetOwner());
+		if (!PC)
 		{
-			if (PC && PC->PlayerCameraManager)
-			{
-				PC->PlayerCameraManager->SetFOV(S.FieldOfView);
-			}
+			PC = UGameplayStatics::GetPlayerController(W, 0);
+		}
+		if (PC && PC->PlayerCameraManager)
+		{
+			PC->PlayerCameraManager->SetFOV(S.FieldOfView);
 		}
 	}
 	// NOTE: Apply invert-Y & sensitivity via your input system (Enhanced Input or BP).
@@ -257,25 +253,26 @@ void UPlayerProfileComponent::ApplySettings()
 
 void UPlayerProfileComponent::SaveSettings()
 {
-	if (USaveSystemSubsystem* Save = GetSaveSystem())
+	USaveSystemSubsystem* Save = GetSaveSystem();
+	if (USaveSystem* SaveObj = GetProfileSave())
 	{
 		const FPlayerSettings& S = CurrentSettings;
 
-		WriteFloat(Save, SETTINGS_OBJECT_ID, TEXT("MasterVolume"),     S.MasterVolume);
-		WriteFloat(Save, SETTINGS_OBJECT_ID, TEXT("SFXVolume"),        S.SFXVolume);
-		WriteFloat(Save, SETTINGS_OBJECT_ID, TEXT("MusicVolume"),      S.MusicVolume);
-		WriteFloat(Save, SETTINGS_OBJECT_ID, TEXT("FieldOfView"),      S.FieldOfView);
-		WriteFloat(Save, SETTINGS_OBJECT_ID, TEXT("MouseSensitivity"), S.MouseSensitivity);
-		WriteBool (Save, SETTINGS_OBJECT_ID, TEXT("bVSync"),           S.bVSync);
-		WriteBool (Save, SETTINGS_OBJECT_ID, TEXT("bInvertY"),         S.bInvertY);
-
-		Save->GetCurrentSaveSystem()->SetField(SETTINGS_OBJECT_ID, TEXT("PreferredDisplayName"), S.PreferredDisplayName);
-		Save->GetCurrentSaveSystem()->SetField(SETTINGS_OBJECT_ID, TEXT("ChosenAvatarId"),       S.ChosenAvatarId);
-		Save->GetCurrentSaveSystem()->SetField(SETTINGS_OBJECT_ID, TEXT("ThemeId"),              S.ThemeId.ToString());
-		Save->GetCurrentSaveSystem()->SetField(SETTINGS_OBJECT_ID, TEXT("QualityPreset"),        FString::FromInt(S.QualityPreset));
-		Save->GetCurrentSaveSystem()->SetField(SETTINGS_OBJECT_ID, TEXT("Version"),              FString::FromInt(S.Version));
-
-		Save->RequestSave(false);
+		WriteFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("MasterVolume"),     S.MasterVolume);
+		WriteFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("SFXVolume"),        S.SFXVolume);
+		WriteFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("MusicVolume"),      S.MusicVolume);
+		WriteFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("FieldOfView"),      S.FieldOfView);
+		WriteFloat(SaveObj, SETTINGS_OBJECT_ID, TEXT("MouseSensitivity"), S.MouseSensitivity);
+		WriteBool (SaveObj, SETTINGS_OBJECT_ID, TEXT("bVSync"),           S.bVSync);
+		WriteBool (SaveObj, SETTINGS_OBJECT_ID, TEXT("bInvertY"),         S.bInvertY);
+
+		SaveObj->SetField(SETTINGS_OBJECT_ID, TEXT("PreferredDisplayName"), S.PreferredDisplayName);
+		SaveObj->SetField(SETTINGS_OBJECT_ID, TEXT("ChosenAvatarId"),       S.ChosenAvatarId);
+		SaveObj->SetName (SETTINGS_OBJECT_ID, TEXT("ThemeId"),              S.ThemeId);
+		SaveObj->SetInt  (SETTINGS_OBJECT_ID, TEXT("QualityPreset"),        S.QualityPreset);
+		SaveObj->SetInt  (SETTINGS_OBJECT_ID, TEXT("Version"),              S.Version);
+
+		Save->RequestSaveForPlayer(CurrentKey.LocalUserNum, false, ESavePriority::High);
 	}
 }
 
@@ -292,10 +289,12 @@ void UPlayerProfileComponent::UpdateSettings(const FPlayerSettings& NewSettings,
 void UPlayerProfileComponent::ResolveProfileKey()
 {
 	// Default fallback
-	CurrentKey = FSaveProfileKey::LocalFallback(0);
+	const int32 UserNum = GetLocalUserNum();
+	CurrentKey = FSaveProfileKey::LocalFallback(UserNum);
 
-	// Prefer EOS if available
-	if (UEOSUnifiedSubsystem* EOS = GetEOSUnified())
+	// Prefer EOS if available (the login belongs to the first local player; split-screen guests stay local)
+	UEOSUnifiedSubsystem* EOS = UserNum == 0 ? GetEOSUnified() : nullptr;
+	if (EOS)
 	{
 		if (EOS->IsLoggedIn())
 		{
@@ -311,7 +310,7 @@ void UPlayerProfileComponent::ResolveProfileKey()
 void UPlayerProfileComponent::RefreshDisplayName()
 {
 	DisplayName.Empty();
-	if (UEOSUnifiedSubsystem* EOS = GetEOSUnified())
+	if (UEOSUnifiedSubsystem* EOS = CurrentKey.LocalUserNum == 0 ? GetEOSUnified() : nullptr)
 	{
 		if (EOS->IsLoggedIn())
 		{
@@ -327,14 +326,28 @@ void UPlayerProfileComponent::MountResolvedProfile()
 {
 	if (USaveSystemSubsystem* Save = GetSaveSystem())
 	{
+		// Async, so split-screen players' slots read in parallel; settings are read once ours is in.
 		const FString Slot = CurrentKey.ToSlotName();
-		Save->SwitchProfile(Slot); // Save layer stays neutral (no EOS knowledge)
+		Save->SwitchProfileForPlayer(CurrentKey.LocalUserNum, Slot, true); // Save layer stays neutral (no EOS knowledge)
+		if (Save->IsLoadInProgressForPlayer(CurrentKey.LocalUserNum))
+		{
+			bPendingMount = true;
+			return;
+		}
+	}
+	FinishMount();
+}
 
+void UPlayerProfileComponent::FinishMount()
+{
+	bPendingMount = false;
+	if (GetSaveSystem())
+	{
 		// Build meta snapshot for the slot
 		TMap<FName, FString> Meta;
 		if (!DisplayName.IsEmpty()) { Meta.Add(TEXT("DisplayName"), DisplayName); CachedMeta.DisplayName = DisplayName; }
 
-		if (UEOSUnifiedSubsystem* EOS = GetEOSUnified())
+		if (UEOSUnifiedSubsystem* EOS = CurrentKey.LocalUserNum == 0 ? GetEOSUnified() : nullptr)
 		{
 			const FString Puid = EOS->GetProductUserIdString();
 			const FString Eas  = EOS->GetLocalEpicAccountIdString();
@@ -350,6 +363,10 @@ void UPlayerProfileComponent::MountResolvedProfile()
 			SetProfileMetaMap(Meta);
 		}
 	}
+
+	bool bFound = false;
+	LoadSettings(bFound);
+	if (bApplyAfterMount) { ApplySettings(); }
 }
 
 // ---------- SaveFramework delegates (dynamic) ----------
@@ -358,6 +375,8 @@ void UPlayerProfileComponent::SubscribeToSaveFrameworkDelegates()
 {
 	if (USaveSystemSubsystem* Save = GetSaveSystem())
 	{
+		Save->OnLoadFinished.AddDynamic(this, &UPlayerProfileComponent::HandleLoadFinished);
+
 		// Use the declaration that matches your USaveSystemSubsystem:
 		// Save->OnProfileMetaUpdated.AddDynamic(this, &UPlayerProfileComponent::HandleProfileMetaUpdated_NoArgs);
 		// or
@@ -369,6 +388,8 @@ void UPlayerProfileComponent::UnsubscribeFromSaveFrameworkDelegates()
 {
 	if (USaveSystemSubsystem* Save = GetSaveSystem())
 	{
+		Save->OnLoadFinished.RemoveDynamic(this, &UPlayerProfileComponent::HandleLoadFinished);
+
 		// Mirror whichever you used in Subscribe:
 		// Save->OnProfileMetaUpdated.RemoveDynamic(this, &UPlayerProfileComponent::HandleProfileMetaUpdated_NoArgs);
 		// Save->OnProfileMetaUpdated.RemoveDynamic(this, &UPlayerProfileComponent::HandleProfileMetaUpdated_WithMeta);
@@ -379,11 +400,8 @@ void UPlayerProfileComponent::HandleProfileMetaUpdated_NoArgs()
 {
 	ResolveProfileKey();
 	RefreshDisplayName();
+	bApplyAfterMount = true;
 	MountResolvedProfile();
-
-	bool bFound = false;
-	LoadSettings(bFound);
-	ApplySettings();
 }
 
 void UPlayerProfileComponent::HandleProfileMetaUpdated_WithMeta(const FPlayerProfileMeta& /*Meta*/)
@@ -391,6 +409,18 @@ void UPlayerProfileComponent::HandleProfileMetaUpdated_WithMeta(const FPlayerPro
 	HandleProfileMetaUpdated_NoArgs();
 }
 
+void UPlayerProfileComponent::HandleLoadFinished(FString SlotName, bool bCompleted)
+{
+	// A cancelled load is always followed by the one that replaced it.
+	USaveSystemSubsystem* Save = GetSaveSystem();
+	if (!bPendingMount || !bCompleted || !Save) return;
+
+	if (SlotName == Save->GetSlotNameForPlayer(CurrentKey.LocalUserNum))
+	{
+		FinishMount();
+	}
+}
+
 // ---------- ISaveable (Save/Load passes) ----------
 
 void UPlayerProfileComponent::SaveData_Implementation(USaveSystem* SaveSystemObj)
@@ -402,19 +432,20 @@ void UPlayerProfileComponent::SaveData_Implementation(USaveSystem* SaveSystemObj
 	if (!CachedMeta.PUID.IsEmpty())        SaveSystemObj->SetField(PROFILE_OBJECT_ID, TEXT("PUID"),        CachedMeta.PUID);
 	if (!CachedMeta.EAS.IsEmpty())         SaveSystemObj->SetField(PROFILE_OBJECT_ID, TEXT("EAS"),         CachedMeta.EAS);
 
-	// Persist current settings snapshot under SETTINGS_OBJECT_ID
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("MasterVolume"),     FString::SanitizeFloat(CurrentSettings.MasterVolume));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("SFXVolume"),        FString::SanitizeFloat(CurrentSettings.SFXVolume));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("MusicVolume"),      FString::SanitizeFloat(CurrentSettings.MusicVolume));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("FieldOfView"),      FString::SanitizeFloat(CurrentSettings.FieldOfView));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("MouseSensitivity"), FString::SanitizeFloat(CurrentSettings.MouseSensitivity));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("bVSync"),           CurrentSettings.bVSync ? TEXT("1") : TEXT("0"));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("bInvertY"),         CurrentSettings.bInvertY ? TEXT("1") : TEXT("0"));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("PreferredDisplayName"), CurrentSettings.PreferredDisplayName);
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("ChosenAvatarId"),       CurrentSettings.ChosenAvatarId);
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("ThemeId"),              CurrentSettings.ThemeId.ToString());
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("QualityPreset"),        FString::FromInt(CurrentSettings.QualityPreset));
-	SaveSystemObj->SetField(SETTINGS_OBJECT_ID, TEXT("Version"),              FString::FromInt(CurrentSettings.Version));
+	// Persist current settings snapshot under SETTINGS_OBJECT_ID (one object lookup, typed writes)
+	FSaveObjectData& Settings = SaveSystemObj->GetOrCreateObject(SETTINGS_OBJECT_ID);
+	Settings.SetFloat (TEXT("MasterVolume"),         CurrentSettings.MasterVolume);
+	Settings.SetFloat (TEXT("SFXVolume"),            CurrentSettings.SFXVolume);
+	Settings.SetFloat (TEXT("MusicVolume"),          CurrentSettings.MusicVolume);
+	Settings.SetFloat (TEXT("FieldOfView"),          CurrentSettings.FieldOfView);
+	Settings.SetFloat (TEXT("MouseSensitivity"),     CurrentSettings.MouseSensitivity);
+	Settings.SetBool  (TEXT("bVSync"),               CurrentSettings.bVSync);
+	Settings.SetBool  (TEXT("bInvertY"),             CurrentSettings.bInvertY);
+	Settings.SetField (TEXT("PreferredDisplayName"), CurrentSettings.PreferredDisplayName);
+	Settings.SetField (TEXT("ChosenAvatarId"),       CurrentSettings.ChosenAvatarId);
+	Settings.SetName  (TEXT("ThemeId"),              CurrentSettings.ThemeId);
+	Settings.SetInt   (TEXT("QualityPreset"),        CurrentSettings.QualityPreset);
+	Settings.SetInt   (TEXT("Version"),              CurrentSettings.Version);
 }
 
 void UPlayerProfileComponent::LoadData_Implementation(USaveSystem* SaveSystemObj, const FSaveObjectData& /*Value*/)
@@ -426,25 +457,22 @@ void UPlayerProfileComponent::LoadData_Implementation(USaveSystem* SaveSystemObj
 	SaveSystemObj->GetField(PROFILE_OBJECT_ID, TEXT("PUID"),        CachedMeta.PUID);
 	SaveSystemObj->GetField(PROFILE_OBJECT_ID, TEXT("EAS"),         CachedMeta.EAS);
 
-	// Rehydrate settings into CurrentSettings
-	auto GetF = [&](const TCHAR* K, float& Out) { FString S; if (SaveSystemObj->GetField(SETTINGS_OBJECT_ID, K, S)) Out = FCString::Atof(*S); };
-	auto GetB = [&](const TCHAR* K, bool&  Out) { FString S; if (SaveSystemObj->GetField(SETTINGS_OBJECT_ID, K, S)) Out = (S==TEXT("1")||S.Equals(TEXT("true"),ESearchCase::IgnoreCase)); };
-	auto GetS = [&](const TCHAR* K, FString& Out){ SaveSystemObj->GetField(SETTINGS_OBJECT_ID, K, Out); };
-
-	GetF(TEXT("MasterVolume"),     CurrentSettings.MasterVolume);
-	GetF(TEXT("SFXVolume"),        CurrentSettings.SFXVolume);
-	GetF(TEXT("MusicVolume"),      CurrentSettings.MusicVolume);
-	GetF(TEXT("FieldOfView"),      CurrentSettings.FieldOfView);
-	GetF(TEXT("MouseSensitivity"), CurrentSettings.MouseSensitivity);
-	GetB(TEXT("bVSync"),           CurrentSettings.bVSync);
-	GetB(TEXT("bInvertY"),         CurrentSettings.bInvertY);
-
-	FString Tmp;
-	GetS(TEXT("PreferredDisplayName"), CurrentSettings.PreferredDisplayName);
-	GetS(TEXT("ChosenAvatarId"),       CurrentSettings.ChosenAvatarId);
-	GetS(TEXT("ThemeId"),              Tmp); if (!Tmp.IsEmpty()) CurrentSettings.ThemeId = FName(*Tmp);
-	GetS(TEXT("QualityPreset"),        Tmp); if (!Tmp.IsEmpty()) CurrentSettings.QualityPreset = FCString::Atoi(*Tmp);
-	GetS(TEXT("Version"),              Tmp); if (!Tmp.IsEmpty()) CurrentSettings.Version       = FCString::Atoi(*Tmp);
+	// Rehydrate settings into CurrentSettings (missing fields keep their current value)
+	if (const FSaveObjectData* Settings = SaveSystemObj->FindObject(SETTINGS_OBJECT_ID))
+	{
+		Settings->GetFloat(TEXT("MasterVolume"),         CurrentSettings.MasterVolume);
+		Settings->GetFloat(TEXT("SFXVolume"),            CurrentSettings.SFXVolume);
+		Settings->GetFloat(TEXT("MusicVolume"),          CurrentSettings.MusicVolume);
+		Settings->GetFloat(TEXT("FieldOfView"),          CurrentSettings.FieldOfView);
+		Settings->GetFloat(TEXT("MouseSensitivity"),     CurrentSettings.MouseSensitivity);
+		Settings->GetBool (TEXT("bVSync"),               CurrentSettings.bVSync);
+		Settings->GetBool (TEXT("bInvertY"),             CurrentSettings.bInvertY);
+		Settings->GetField(TEXT("PreferredDisplayName"), CurrentSettings.PreferredDisplayName);
+		Settings->GetField(TEXT("ChosenAvatarId"),       CurrentSettings.ChosenAvatarId);
+		Settings->GetName (TEXT("ThemeId"),              CurrentSettings.ThemeId);
+		Settings->GetInt  (TEXT("QualityPreset"),        CurrentSettings.QualityPreset);
+		Settings->GetInt  (TEXT("Version"),              CurrentSettings.Version);
+	}
 
 	ClampAndMigrate(CurrentSettings);
 	bLoaded = true;
@@ -472,6 +500,17 @@ USaveSystemSubsystem* UPlayerProfileComponent::GetSaveSystem() const
 	return nullptr;
 }
 
+USaveSystem* UPlayerProfileComponent::GetProfileSave() const
+{
+	USaveSystemSubsystem* Save = GetSaveSystem();
+	return Save ? Save->GetSaveSystemForPlayer(CurrentKey.LocalUserNum) : nullptr;
+}
+
+int32 UPlayerProfileComponent::GetLocalUserNum() const
+{
+	return USaveSystemSubsystem::GetSaveableUserNum(this);
+}
+
 UObject* UPlayerProfileComponent::GetWorldContext() const
 {
 	return GetOwner() ? (UObject*)GetOwner() : (UObject*)this;
@@ -17,6 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerProfileKeyChanged, const FS
 /**
  * Owns profile resolution (EOS/local) and directs the SaveSystemSubsystem
  * to switch slots; all persistence and application of PlayerSettings is handled here.
+ * Each local player's component mounts its own profile (split-screen), keyed by its LocalPlayer index.
  */
 UCLASS(ClassGroup=(Game), meta=(BlueprintSpawnableComponent))
 class UPlayerProfileComponent : public UActorComponent, public ISaveable
@@ -91,6 +92,10 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Profile|Meta")
 	FPlayerProfileMeta GetProfileMetaSnapshot() const;
 
+	/** LocalPlayer index of the owning controller (0 without one). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Profile")
+	int32 GetLocalUserNum() const;
+
 	/** Optional hook so UI can react instantly; add your own multicast if you want live updates. */
 	void BroadcastMetaSnapshot() {}
 
@@ -107,6 +112,7 @@ private:
 	void ResolveProfileKey();
 	void RefreshDisplayName();
 	void MountResolvedProfile(); // switch the slot + push meta into save subsystem
+	void FinishMount();          // meta + settings once the slot's data is in
 
 	// Apply helpers
 	void ClampAndMigrate(FPlayerSettings& S) const;
@@ -116,6 +122,8 @@ private:
 	// Accessors
 	UEOSUnifiedSubsystem* GetEOSUnified() const;
 	USaveSystemSubsystem* GetSaveSystem() const;
+	/** Save object of this player's profile. */
+	USaveSystem* GetProfileSave() const;
 	UObject* GetWorldContext() const;
 
 	// SaveFramework dynamic delegate support (bind whichever signature you actually expose)
@@ -124,8 +132,15 @@ private:
 	void SubscribeToSaveFrameworkDelegates();
 	void UnsubscribeFromSaveFrameworkDelegates();
 
+	/** Finishes a mount whose slot was still loading. */
+	UFUNCTION() void HandleLoadFinished(FString SlotName, bool bCompleted);
+
 private:
 	// Local cached meta for cheap UI reads
 	struct FLocalMetaCache { FString DisplayName, PUID, EAS; bool IsEmpty() const { return DisplayName.IsEmpty() && PUID.IsEmpty() && EAS.IsEmpty(); } };
 	FLocalMetaCache CachedMeta;
+
+	/** Async mount waiting for OnLoadFinished; whether InitializeProfile asked to apply afterwards. */
+	bool bPendingMount = false;
+	bool bApplyAfterMount = true;
 };
@@ -152,4 +152,6 @@ struct FProfileSlotInfo
 	UPROPERTY(EditAnywhere, BlueprintReadWrite) FString Platform;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite) FString Namespace;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite) int32   LocalUserNum = 0;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite) FDateTime LastSaved;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite) int64   SizeBytes = 0;
 };
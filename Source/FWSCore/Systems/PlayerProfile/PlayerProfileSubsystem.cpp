@@ -3,8 +3,8 @@
 #include "FWSCore/Player/PlayerProfileComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "FWSCore/Systems/Save/SaveSystem.h"
 #include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
 #include "Dom/JsonObject.h"
 
 USaveSystemSubsystem* UPlayerProfileSubsystem::GetSave() const
@@ -31,34 +31,37 @@ bool UPlayerProfileSubsystem::WriteJson(const FName ObjectId, const FName Key, c
 	return false;
 }
 
-// Minimal JSON (UE structs → JSON string)
-bool UPlayerProfileSubsystem::ToJson(const FCharacterProfile& In, FString& Out) const
+bool UPlayerProfileSubsystem::ReadCharacter(const FString& CharacterId, FCharacterProfile& Out) const
 {
-	// Simple manual writer (tiny schema)
-	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-	Root->SetStringField(TEXT("Id"), In.CharacterId);
-	Root->SetStringField(TEXT("Name"), In.CharacterName);
-	Root->SetStringField(TEXT("Archetype"), In.ArchetypeId.ToString());
-	Root->SetNumberField(TEXT("Version"), In.Version);
-	Root->SetNumberField(TEXT("Level"), In.Level);
-	Root->SetNumberField(TEXT("XP"), In.Experience);
-	Root->SetNumberField(TEXT("Currency"), In.Currency);
-	Root->SetNumberField(TEXT("BaseMaxHealth"), In.BaseMaxHealth);
-	Root->SetNumberField(TEXT("EarnedMaxHealth"), In.EarnedMaxHealth);
-
-	TArray<TSharedPtr<FJsonValue>> Ab;
-	for (const FName& N : In.AbilitiesUnlocked) Ab.Add(MakeShared<FJsonValueString>(N.ToString()));
-	Root->SetArrayField(TEXT("Abilities"), Ab);
-
-	TArray<TSharedPtr<FJsonValue>> It;
-	for (const FName& N : In.ItemsUnlocked) It.Add(MakeShared<FJsonValueString>(N.ToString()));
-	Root->SetArrayField(TEXT("Items"), It);
-
-	Root->SetNumberField(TEXT("SecondsPlayed"), (double)In.SecondsPlayed);
-
-	TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&Out);
-	return FJsonSerializer::Serialize(Root, W);
+	auto* S = GetSave();
+	const USaveSystem* Save = S ? S->GetCurrentSaveSystem() : nullptr;
+	if (!Save) return false;
+
+	const FName ObjectId(*ObjIdForCharacter(CharacterId));
+	if (Save->GetStruct(ObjectId, Out))
+	{
+		return true;
+	}
+
+	// Legacy slot: JSON string field (rewritten as a struct payload the next time the character is saved).
+	FString Json;
+	return Save->GetField(ObjectId, TEXT("Data"), Json) && FromJson(Json, Out);
+}
+
+bool UPlayerProfileSubsystem::WriteCharacter(const FCharacterProfile& Profile, bool bSaveNow) const
+{
+	auto* S = GetSave();
+	USaveSystem* Save = S ? S->GetCurrentSaveSystem() : nullptr;
+	if (!Save) return false;
+
+	FSaveObjectData& Data = Save->GetOrCreateObject(*ObjIdForCharacter(Profile.CharacterId));
+	Data.WriteStruct(Profile);
+	Data.RemoveField(TEXT("Data"));
+	if (bSaveNow) S->RequestSave(true);
+	return true;
 }
+
+// Legacy JSON (slots written before character data moved to the struct payload)
 bool UPlayerProfileSubsystem::FromJson(const FString& In, FCharacterProfile& Out) const
 {
 	TSharedPtr<FJsonObject> Root;
@@ -103,8 +106,7 @@ void UPlayerProfileSubsystem::RefreshCharacterList()
 		for (const FString& Id : Ids)
 		{
 			FCharacterProfile P;
-			FString Json;
-			if (ReadJson(*ObjIdForCharacter(Id), TEXT("Data"), Json) && FromJson(Json, P))
+			if (ReadCharacter(Id, P))
 			{
 				FCharacterSummary S;
 				S.CharacterId   = P.CharacterId;
@@ -131,9 +133,7 @@ bool UPlayerProfileSubsystem::CreateCharacter(const FString& Name, const FName A
 	// Defaults (version/level/health already set)
 
 	// Persist
-	FString Json;
-	if (!ToJson(OutProfile, Json)) return false;
-	if (!WriteJson(*ObjIdForCharacter(Id), TEXT("Data"), Json, false)) return false;
+	if (!WriteCharacter(OutProfile, false)) return false;
 
 	// Update index
 	FString Csv;
@@ -148,8 +148,11 @@ bool UPlayerProfileSubsystem::CreateCharacter(const FString& Name, const FName A
 
 bool UPlayerProfileSubsystem::DeleteCharacter(const FString& CharacterId)
 {
-	// Removing a field: there’s no explicit delete in SaveSystem facade yet,
-	// so we overwrite the entry with "{}" and remove from the index string.
+	auto* S = GetSave();
+	USaveSystem* Save = S ? S->GetCurrentSaveSystem() : nullptr;
+	if (!Save) return false;
+
+	// Drop the character's object and remove it from the index string.
 	FString Csv;
 	ReadJson(TEXT("Characters"), TEXT("Index"), Csv);
 
@@ -161,10 +164,10 @@ bool UPlayerProfileSubsystem::DeleteCharacter(const FString& CharacterId)
 	{
 		FString NewCsv = FString::Join(Ids, TEXT(","));
 		WriteJson(TEXT("Characters"), TEXT("Index"), NewCsv, false);
-		WriteJson(*ObjIdForCharacter(CharacterId), TEXT("Data"), TEXT("{}"), false);
+		Save->RemoveObject(*ObjIdForCharacter(CharacterId));
 
 		if (ActiveCharacterId == CharacterId) ActiveCharacterId.Empty();
-		GetSave()->RequestSave(true);
+		S->RequestSave(true, ESavePriority::High);
 		RefreshCharacterList();
 		return true;
 	}
@@ -173,16 +176,19 @@ bool UPlayerProfileSubsystem::DeleteCharacter(const FString& CharacterId)
 
 bool UPlayerProfileSubsystem::LoadCharacter(const FString& CharacterId, FCharacterProfile& OutProfile)
 {
-	FString Json;
-	if (!ReadJson(*ObjIdForCharacter(CharacterId), TEXT("Data"), Json)) return false;
-	return FromJson(Json, OutProfile);
+	return ReadCharacter(CharacterId, OutProfile);
 }
 
 bool UPlayerProfileSubsystem::SaveCharacter(const FCharacterProfile& Profile)
 {
-	FString Json;
-	if (!ToJson(Profile, Json)) return false;
-	const bool Ok = WriteJson(*ObjIdForCharacter(Profile.CharacterId), TEXT("Data"), Json, true);
+	const bool Ok = StageCharacter(Profile);
+	if (Ok) GetSave()->RequestSave(true);
+	return Ok;
+}
+
+bool UPlayerProfileSubsystem::StageCharacter(const FCharacterProfile& Profile)
+{
+	const bool Ok = WriteCharacter(Profile, false);
 	if (Ok && Profile.CharacterId == ActiveCharacterId)
 	{
 		// Reflect to UI if we just saved the active one
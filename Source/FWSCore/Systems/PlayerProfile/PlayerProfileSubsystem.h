@@ -35,6 +35,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Profiles")
 	bool SaveCharacter(const FCharacterProfile& Profile);
 
+	/** SaveCharacter without requesting a save: for callers that write their data when a scheduled save starts. */
+	bool StageCharacter(const FCharacterProfile& Profile);
+
 	UFUNCTION(BlueprintCallable, Category="Profiles")
 	void SetActiveCharacterId(const FString& CharacterId);
 
@@ -59,7 +62,10 @@ private:
 	static FString ObjIdForCharacter(const FString& Id) { return FString::Printf(TEXT("Characters/%s"), *Id); }
 	bool ReadJson(const FName ObjectId, const FName Key, FString& OutJson) const;
 	bool WriteJson(const FName ObjectId, const FName Key, const FString& Json, bool bSaveNow) const;
-	bool ToJson(const FCharacterProfile& In, FString& Out) const;
+
+	/** Character data lives in the object's struct payload; slots from before that carry it as JSON under "Data". */
+	bool ReadCharacter(const FString& CharacterId, FCharacterProfile& Out) const;
+	bool WriteCharacter(const FCharacterProfile& Profile, bool bSaveNow) const;
 	bool FromJson(const FString& In, FCharacterProfile& Out) const;
 	void EnsureActiveConsistency();
 };
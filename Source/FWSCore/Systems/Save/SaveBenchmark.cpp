@@ -0,0 +1,801 @@
+﻿#include "FWSCore.h"
+#include "SaveSystem.h"
+#include "SaveSlotFormat.h"
+#include "SaveSlotStorage.h"
+#include "SaveJournal.h"
+#include "SaveSystemSubsystem.h"
+#include "SaveBenchmarkActor.h"
+#include "SaveIdComponent.h"
+#include "FWSCore/Shared/CharacterProfileTypes.h"
+#include "JsonObjectConverter.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformMemory.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "TimerManager.h"
+#include "UObject/Package.h"
+
+/**
+ * Developer benchmarks for the save pipeline. Results go to the log (LogSaveSystem).
+ *
+ *   FWS.Save.BenchCompression [Iterations=20] [Slot=current]
+ *     Encodes the slot with every available codec/level and reports size, compress,
+ *     decompress and end-to-end load (file read + verify + decode + apply) times.
+ *
+ *   FWS.Save.FormatReport [Iterations=20] [Slot=current]
+ *     Encodes the slot as a legacy USaveGame blob (SaveGameToMemory) and in the FWS container, uncompressed,
+ *     and reports size, encode, index decode (FWS only) and full decode times.
+ *
+ *   FWS.Save.BenchStruct [Iterations=1000] [Entries=32]
+ *     Round-trips a sample FCharacterProfile (Entries abilities + items) through FSaveObjectData::WriteStruct /
+ *     ReadStruct and through an FJsonObject string field, and reports stored bytes and encode/decode times.
+ *
+ *   FWS.Save.BenchDispatch [Objects=1000] [Iterations=50]
+ *     Calls SaveData and LoadData of Objects field-less ASaveBenchmarkActors through ISaveable::Execute_*
+ *     (ProcessEvent) and through FSaveableDispatch (direct virtual call), and reports ns per object for each.
+ *
+ *   FWS.Save.BenchSuite [Objects=1000] [Fields=8] [PayloadBytes=64] [GuidRatio=0.5] [DirtyRatio=0.1] [Iterations=10]
+ *     Spawns synthetic saveables (ASaveBenchmarkActor) into a scratch profile and drives sync/async
+ *     saves and loads through the subsystem, one phase per frame. Reports p50/p95 game-thread ms,
+ *     wall ms, bytes written and used-memory delta per phase, and writes <Saved>/Profiling/SaveBench/*.csv|json.
+ *     The current profile is saved first and reloaded afterwards; don't run it mid-gameplay.
+ */
+namespace
+{
+	double MedianMs(TArray<double>& Samples)
+	{
+		if (Samples.Num() == 0) return 0.0;
+		Samples.Sort();
+		return Samples[Samples.Num() / 2] * 1000.0;
+	}
+
+	/** Snapshot of the slot on disk (with journal replayed), or of the in-memory save if it was never written. */
+	bool LoadBenchSnapshot(USaveSystemSubsystem& SaveSub, const FString& Slot, FSaveSnapshot& OutSnapshot)
+	{
+		{
+			FScopeLock Lock(&SaveJournal::GetSlotLock(Slot));
+			TArray<uint8> Bytes;
+			if (SaveSlotStorage::ReadNewestValid(Slot, Bytes) && SaveSlotFormat::Read(Bytes, OutSnapshot))
+			{
+				SaveJournal::Replay(Slot, OutSnapshot);
+				// Encode timings should cover real object encoding, not lazy pass-through copies.
+				OutSnapshot.Undecoded.DecodeAllInto(OutSnapshot.PlayerSave);
+				return true;
+			}
+		}
+
+		if (USaveSystem* Current = SaveSub.GetCurrentSaveSystem(); Current && Slot == SaveSub.GetCurrentSlotName())
+		{
+			OutSnapshot = Current->MakeSnapshot();
+			OutSnapshot.Undecoded.DecodeAllInto(OutSnapshot.PlayerSave);
+			return true;
+		}
+		return false;
+	}
+
+	void RunCompressionBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		USaveSystemSubsystem* SaveSub = GI ? GI->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+		if (!SaveSub)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] No SaveSystemSubsystem in this world."));
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+		const FString Slot = Args.Num() > 1 ? Args[1] : SaveSub->GetCurrentSlotName();
+
+		FSaveSnapshot Snapshot;
+		if (!LoadBenchSnapshot(*SaveSub, Slot, Snapshot))
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] Slot %s has no readable FWS image."), *Slot);
+			return;
+		}
+
+		const FString TempPath = FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("__SaveBenchmark.tmp");
+		USaveSystem* Target = NewObject<USaveSystem>(GetTransientPackage());
+
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] Slot %s: %d named + %d GUID objects, %d iterations (median ms)."),
+			*Slot, Snapshot.PlayerSave.ObjectData.Num() + Snapshot.Undecoded.Named.Num(),
+			Snapshot.PlayerSave.GuidObjectData.Num() + Snapshot.Undecoded.Guids.Num(), Iterations);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-8s %-9s %10s %7s %9s %9s %9s"),
+			TEXT("Codec"), TEXT("Level"), TEXT("Bytes"), TEXT("Ratio"), TEXT("Encode"), TEXT("Decode"), TEXT("Load"));
+
+		int32 RawSize = 0;
+		const UEnum* CodecEnum = StaticEnum<ESaveCompressionCodec>();
+		const UEnum* LevelEnum = StaticEnum<ESaveCompressionLevel>();
+
+		for (int32 CodecIdx = 0; CodecIdx < CodecEnum->NumEnums() - 1; ++CodecIdx)
+		{
+			const ESaveCompressionCodec Codec = static_cast<ESaveCompressionCodec>(CodecEnum->GetValueByIndex(CodecIdx));
+			if (!SaveSlotFormat::IsCodecAvailable(Codec)) continue;
+
+			// Level has no effect without a codec.
+			const int32 NumLevels = Codec == ESaveCompressionCodec::None ? 1 : LevelEnum->NumEnums() - 1;
+			for (int32 LevelIdx = 0; LevelIdx < NumLevels; ++LevelIdx)
+			{
+				SaveSlotFormat::FEncodeOptions Options;
+				Options.Codec = Codec;
+				Options.Level = Codec == ESaveCompressionCodec::None
+					? ESaveCompressionLevel::Balanced
+					: static_cast<ESaveCompressionLevel>(LevelEnum->GetValueByIndex(LevelIdx));
+
+				TArray<uint8> Bytes;
+				TArray<double> EncodeSamples, DecodeSamples, LoadSamples;
+				for (int32 i = 0; i < Iterations; ++i)
+				{
+					const double T0 = FPlatformTime::Seconds();
+					SaveSlotFormat::Write(Snapshot, Bytes, Options);
+					EncodeSamples.Add(FPlatformTime::Seconds() - T0);
+				}
+				if (Codec == ESaveCompressionCodec::None)
+				{
+					RawSize = Bytes.Num();
+				}
+
+				FFileHelper::SaveArrayToFile(Bytes, *TempPath);
+
+				for (int32 i = 0; i < Iterations; ++i)
+				{
+					FSaveSnapshot Decoded;
+					const double T0 = FPlatformTime::Seconds();
+					SaveSlotFormat::Read(Bytes, Decoded);
+					DecodeSamples.Add(FPlatformTime::Seconds() - T0);
+				}
+
+				for (int32 i = 0; i < Iterations; ++i)
+				{
+					const double T0 = FPlatformTime::Seconds();
+					TArray<uint8> FileBytes;
+					FSaveSnapshot Decoded;
+					if (FFileHelper::LoadFileToArray(FileBytes, *TempPath) && SaveSlotFormat::Read(FileBytes, Decoded))
+					{
+						Target->ApplySnapshot(MoveTemp(Decoded));
+					}
+					LoadSamples.Add(FPlatformTime::Seconds() - T0);
+				}
+
+				UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-8s %-9s %10d %6.2fx %9.3f %9.3f %9.3f"),
+					*CodecEnum->GetNameStringByIndex(CodecIdx),
+					Codec == ESaveCompressionCodec::None ? TEXT("-") : *LevelEnum->GetNameStringByValue(static_cast<int64>(Options.Level)),
+					Bytes.Num(),
+					Bytes.Num() > 0 && RawSize > 0 ? static_cast<double>(RawSize) / Bytes.Num() : 1.0,
+					MedianMs(EncodeSamples), MedianMs(DecodeSamples), MedianMs(LoadSamples));
+			}
+		}
+
+		IFileManager::Get().Delete(*TempPath, /*RequireExists*/false, /*EvenReadOnly*/true, /*Quiet*/true);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] Load = file read (likely OS-cached) + CRC + index decode + ApplySnapshot; objects decode lazily."));
+	}
+
+	void RunFormatReport(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		USaveSystemSubsystem* SaveSub = GI ? GI->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+		if (!SaveSub)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] No SaveSystemSubsystem in this world."));
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+		const FString Slot = Args.Num() > 1 ? Args[1] : SaveSub->GetCurrentSlotName();
+
+		FSaveSnapshot Snapshot;
+		if (!LoadBenchSnapshot(*SaveSub, Slot, Snapshot))
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] Slot %s has no readable FWS image."), *Slot);
+			return;
+		}
+
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] Slot %s: %d named + %d GUID objects, %d iterations (median ms, uncompressed)."),
+			*Slot, Snapshot.PlayerSave.ObjectData.Num(), Snapshot.PlayerSave.GuidObjectData.Num(), Iterations);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-7s %10s %7s %6s %9s %9s %10s"),
+			TEXT("Layout"), TEXT("Bytes"), TEXT("Size"), TEXT("Names"), TEXT("Encode"), TEXT("Index"), TEXT("DecodeAll"));
+
+		// Legacy: what slots written before the FWS container hold, and what SaveGameToSlot still produces.
+		USaveSystem* Legacy = NewObject<USaveSystem>(GetTransientPackage());
+		Legacy->ApplySnapshot(FSaveSnapshot(Snapshot));
+
+		TArray<uint8> LegacyBytes;
+		TArray<double> LegacyEncodeSamples, LegacyDecodeSamples;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const double T0 = FPlatformTime::Seconds();
+			UGameplayStatics::SaveGameToMemory(Legacy, LegacyBytes);
+			LegacyEncodeSamples.Add(FPlatformTime::Seconds() - T0);
+		}
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const double T0 = FPlatformTime::Seconds();
+			UGameplayStatics::LoadGameFromMemory(LegacyBytes);
+			LegacyDecodeSamples.Add(FPlatformTime::Seconds() - T0);
+		}
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-7s %10d %6.1f%% %6s %9.3f %9s %10.3f"),
+			TEXT("legacy"), LegacyBytes.Num(), 100.0, TEXT("-"), MedianMs(LegacyEncodeSamples), TEXT("-"), MedianMs(LegacyDecodeSamples));
+
+		TArray<uint8> Bytes;
+		TArray<double> EncodeSamples, IndexSamples, DecodeAllSamples;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const double T0 = FPlatformTime::Seconds();
+			SaveSlotFormat::Write(Snapshot, Bytes);
+			EncodeSamples.Add(FPlatformTime::Seconds() - T0);
+		}
+
+		int32 NumNames = 0;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FSaveSnapshot Decoded;
+			const double T0 = FPlatformTime::Seconds();
+			SaveSlotFormat::Read(Bytes, Decoded);
+			const double T1 = FPlatformTime::Seconds();
+			NumNames = Decoded.Undecoded.Names.IsValid() ? Decoded.Undecoded.Names->Num() : 0;
+			Decoded.Undecoded.DecodeAllInto(Decoded.PlayerSave);
+			IndexSamples.Add(T1 - T0);
+			DecodeAllSamples.Add(FPlatformTime::Seconds() - T0);
+		}
+
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-7s %10d %6.1f%% %6d %9.3f %9.3f %10.3f"),
+			*FString::Printf(TEXT("v%d"), SaveSlotFormat::CurrentFormatVersion),
+			Bytes.Num(),
+			LegacyBytes.Num() > 0 ? 100.0 * Bytes.Num() / LegacyBytes.Num() : 100.0,
+			NumNames,
+			MedianMs(EncodeSamples), MedianMs(IndexSamples), MedianMs(DecodeAllSamples));
+	}
+
+	void RunStructBenchmark(const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 Entries = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 32;
+
+		FCharacterProfile Profile;
+		Profile.CharacterId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
+		Profile.CharacterName = TEXT("Benchmark Character");
+		Profile.ArchetypeId = TEXT("Archetype_Ranger");
+		Profile.Level = 37;
+		Profile.Experience = 123456;
+		Profile.Currency = 98765;
+		Profile.EarnedMaxHealth = 42.5f;
+		Profile.SecondsPlayed = 360000;
+		for (int32 i = 0; i < Entries; ++i)
+		{
+			Profile.AbilitiesUnlocked.Add(FName(TEXT("Ability"), i + 1));
+			Profile.ItemsUnlocked.Add(FName(TEXT("Item"), i + 1));
+		}
+
+		// Binary: tagged properties into the object's payload.
+		FSaveObjectData Binary;
+		TArray<double> BinaryWrite, BinaryRead;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Binary.BinaryPayload.Reset();
+			const double T0 = FPlatformTime::Seconds();
+			Binary.WriteStruct(Profile);
+			BinaryWrite.Add(FPlatformTime::Seconds() - T0);
+		}
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FCharacterProfile Out;
+			const double T0 = FPlatformTime::Seconds();
+			Binary.ReadStruct(Out);
+			BinaryRead.Add(FPlatformTime::Seconds() - T0);
+		}
+
+		// JSON: FJsonObject string stored in a String field (the previous character data path).
+		FSaveObjectData Json;
+		TArray<double> JsonWrite, JsonRead;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const double T0 = FPlatformTime::Seconds();
+			FString Str;
+			FJsonObjectConverter::UStructToJsonObjectString(Profile, Str, 0, 0, 0, nullptr, /*bPrettyPrint*/false);
+			Json.SetField(TEXT("Data"), Str);
+			JsonWrite.Add(FPlatformTime::Seconds() - T0);
+		}
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FCharacterProfile Out;
+			const double T0 = FPlatformTime::Seconds();
+			FString Str;
+			Json.GetField(TEXT("Data"), Str);
+			FJsonObjectConverter::JsonObjectStringToUStruct(Str, &Out);
+			JsonRead.Add(FPlatformTime::Seconds() - T0);
+		}
+
+		// Stored size = what the slot carries for the object (row form, uncompressed).
+		auto EncodedSize = [](FSaveObjectData& Data)
+		{
+			FSaveSnapshot Snapshot;
+			TArray<uint8> Empty, Bytes;
+			SaveSlotFormat::Write(Snapshot, Empty);
+			Snapshot.PlayerSave.ObjectData.Add(TEXT("Bench"), Data);
+			SaveSlotFormat::Write(Snapshot, Bytes);
+			return Bytes.Num() - Empty.Num();
+		};
+
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] FCharacterProfile (%d abilities + %d items), %d iterations (median us)."),
+			Entries, Entries, Iterations);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-7s %8s %9s %9s"), TEXT("Path"), TEXT("Bytes"), TEXT("Write"), TEXT("Read"));
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-7s %8d %9.2f %9.2f"), TEXT("Struct"),
+			EncodedSize(Binary), MedianMs(BinaryWrite) * 1000.0, MedianMs(BinaryRead) * 1000.0);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-7s %8d %9.2f %9.2f"), TEXT("JSON"),
+			EncodedSize(Json), MedianMs(JsonWrite) * 1000.0, MedianMs(JsonRead) * 1000.0);
+	}
+
+	void RunDispatchBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] BenchDispatch needs a world."));
+			return;
+		}
+
+		const int32 NumObjects = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 50;
+
+		// No fields or payload: what's left of each call is the dispatch plus a lookup of the object's payload.
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		TArray<ASaveBenchmarkActor*> Actors;
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			if (ASaveBenchmarkActor* Actor = World->SpawnActor<ASaveBenchmarkActor>(Params))
+			{
+				Actor->Configure(0, 0);
+				Actors.Add(Actor);
+			}
+		}
+		if (Actors.Num() == 0) return;
+
+		USaveSystem* Target = NewObject<USaveSystem>(GetTransientPackage());
+		const FSaveObjectData Empty;
+		const bool bWasEnabled = FSaveableDispatch::IsEnabled();
+
+		// Per phase: median over Iterations passes of the per-object time, in ns.
+		auto Measure = [&](bool bNative, bool bLoad)
+		{
+			FSaveableDispatch::SetEnabled(bNative);
+			TArray<double> Samples;
+			for (int32 Pass = 0; Pass <= Iterations; ++Pass)
+			{
+				const double T0 = FPlatformTime::Seconds();
+				for (ASaveBenchmarkActor* Actor : Actors)
+				{
+					if (bLoad)
+					{
+						FSaveableDispatch::LoadData(Actor, Target, Empty);
+					}
+					else
+					{
+						FSaveableDispatch::SaveData(Actor, Target);
+					}
+				}
+				// Pass 0 warms caches and creates the payloads.
+				if (Pass > 0)
+				{
+					Samples.Add((FPlatformTime::Seconds() - T0) / Actors.Num());
+				}
+			}
+			return MedianMs(Samples) * 1000000.0;
+		};
+
+		const double SaveReflect = Measure(false, false);
+		const double SaveNative  = Measure(true, false);
+		const double LoadReflect = Measure(false, true);
+		const double LoadNative  = Measure(true, true);
+		FSaveableDispatch::SetEnabled(bWasEnabled);
+
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] ISaveable dispatch, %d objects, %d iterations (median ns per object)."),
+			Actors.Num(), Iterations);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-8s %11s %9s %9s"), TEXT("Event"), TEXT("Reflection"), TEXT("Native"), TEXT("Saved"));
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-8s %11.1f %9.1f %9.1f"), TEXT("SaveData"), SaveReflect, SaveNative, SaveReflect - SaveNative);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-8s %11.1f %9.1f %9.1f"), TEXT("LoadData"), LoadReflect, LoadNative, LoadReflect - LoadNative);
+
+		for (ASaveBenchmarkActor* Actor : Actors)
+		{
+			Actor->Destroy();
+		}
+	}
+
+	/* ---------- Suite ---------- */
+
+	double Percentile(TArray<double> Samples, double Fraction)
+	{
+		if (Samples.Num() == 0) return 0.0;
+		Samples.Sort();
+		// Nearest-rank.
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Samples.Num()), 1, Samples.Num());
+		return Samples[Rank - 1];
+	}
+
+	/** Process-wide used physical memory; phase deltas cover worker allocations too, without touching the allocator. */
+	int64 GetUsedPhysical()
+	{
+		return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	}
+
+	struct FSuiteConfig
+	{
+		int32 Objects = 1000;
+		int32 Fields = 8;
+		int32 PayloadBytes = 64;
+		float GuidRatio = 0.5f;
+		float DirtyRatio = 0.1f;
+		int32 Iterations = 10;
+	};
+
+	enum class EBenchPhase : uint8
+	{
+		SaveSync,
+		SaveAsync,
+		LoadSync,
+		LoadAsync,
+		Num
+	};
+
+	const TCHAR* GetPhaseName(EBenchPhase Phase)
+	{
+		static const TCHAR* Names[] = { TEXT("SaveSync"), TEXT("SaveAsync"), TEXT("LoadSync"), TEXT("LoadAsync") };
+		return Names[static_cast<int32>(Phase)];
+	}
+
+	bool IsSavePhase(EBenchPhase Phase) { return Phase == EBenchPhase::SaveSync || Phase == EBenchPhase::SaveAsync; }
+
+	struct FBenchSample
+	{
+		EBenchPhase Phase = EBenchPhase::SaveSync;
+		int32 Iteration = 0;
+		double GameThreadMs = 0.0;
+		double WallMs = 0.0;
+		int64 BytesWritten = 0;
+		int64 MemoryDeltaBytes = 0;
+		int32 Frames = 0;
+	};
+
+	/** Multi-frame runner: one phase starts per frame; async phases are polled until the subsystem reports them done. */
+	class FSaveBenchSuite : public TSharedFromThis<FSaveBenchSuite>
+	{
+	public:
+		static constexpr const TCHAR* ScratchSlot = TEXT("__SaveBenchmark");
+
+		FSaveBenchSuite(UWorld* InWorld, USaveSystemSubsystem* InSaveSub, const FSuiteConfig& InConfig)
+			: World(InWorld), SaveSub(InSaveSub), Config(InConfig)
+		{
+		}
+
+		bool IsAlive() const { return World.IsValid() && SaveSub.IsValid(); }
+
+		bool Start()
+		{
+			if (SaveSub->IsSaveInFlight())
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] A save is in flight; try again once it finishes."));
+				return false;
+			}
+
+			// Persist the live profile; it is reloaded from disk when the suite ends.
+			OriginalSlot = SaveSub->GetCurrentSlotName();
+			SaveSub->SaveNow(false);
+			SaveSub->DeleteProfile(ScratchSlot);
+			SaveSub->SwitchProfile(ScratchSlot);
+
+			const int32 NumGuid = FMath::RoundToInt(Config.Objects * FMath::Clamp(Config.GuidRatio, 0.f, 1.f));
+			FActorSpawnParameters Params;
+			Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			Actors.Reserve(Config.Objects);
+			for (int32 i = 0; i < Config.Objects; ++i)
+			{
+				ASaveBenchmarkActor* Actor = World->SpawnActor<ASaveBenchmarkActor>(Params);
+				if (!Actor) continue;
+
+				Actor->Configure(Config.Fields, Config.PayloadBytes);
+				if (i < NumGuid)
+				{
+					// Must exist before registration: the registry captures the id component once.
+					USaveIdComponent* SaveId = NewObject<USaveIdComponent>(Actor);
+					Actor->AddInstanceComponent(SaveId);
+					SaveId->RegisterComponent();
+				}
+				SaveSub->RegisterSaveable(Actor);
+				Actors.Add(Actor);
+			}
+
+			UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] Suite: %d objects (%d GUID), %d fields, %d payload bytes, %.0f%% dirty, %d iterations."),
+				Actors.Num(), NumGuid, Config.Fields, Config.PayloadBytes, Config.DirtyRatio * 100.f, Config.Iterations);
+
+			BeginPhase();
+			ScheduleTick();
+			return true;
+		}
+
+		/** Drops the suite without writing results (world went away). */
+		void Abort()
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] Suite aborted after %d samples."), Samples.Num());
+		}
+
+	private:
+		void ScheduleTick()
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateSP(this, &FSaveBenchSuite::Tick));
+		}
+
+		void Tick();
+
+		void BeginPhase()
+		{
+			if (IsSavePhase(Phase) && Actors.Num() > 0)
+			{
+				const int32 NumDirty = FMath::RoundToInt(Actors.Num() * FMath::Clamp(Config.DirtyRatio, 0.f, 1.f));
+				for (int32 i = 0; i < NumDirty; ++i)
+				{
+					if (ASaveBenchmarkActor* Actor = Actors[(DirtyCursor + i) % Actors.Num()].Get())
+					{
+						Actor->Mutate();
+					}
+				}
+				DirtyCursor = (DirtyCursor + NumDirty) % Actors.Num();
+			}
+
+			// Marks the phase in a -trace=memory Insights session, which has the per-allocation detail.
+			TRACE_BOOKMARK(TEXT("SaveBench %s #%d"), GetPhaseName(Phase), Iteration);
+
+			Frames = 1;
+			PhaseStartUsedPhysical = GetUsedPhysical();
+			PhaseStartSeconds = FPlatformTime::Seconds();
+
+			switch (Phase)
+			{
+			case EBenchPhase::SaveSync:  SaveSub->SaveNow(false); break;
+			case EBenchPhase::SaveAsync: SaveSub->SaveNow(true); break;
+			case EBenchPhase::LoadSync:  SaveSub->RequestLoad(false); break;
+			case EBenchPhase::LoadAsync: SaveSub->RequestLoad(true); break;
+			default: break;
+			}
+			PhaseEndSeconds = FPlatformTime::Seconds();
+			bAwaitingCompletion = IsPhaseInFlight();
+		}
+
+		bool IsPhaseInFlight() const
+		{
+			return (Phase == EBenchPhase::SaveAsync && SaveSub->IsSaveInFlight())
+				|| (Phase == EBenchPhase::LoadAsync && SaveSub->IsLoadInProgress());
+		}
+
+		void EndPhase()
+		{
+			FBenchSample& Sample = Samples.AddDefaulted_GetRef();
+			Sample.Phase = Phase;
+			Sample.Iteration = Iteration;
+			Sample.GameThreadMs = IsSavePhase(Phase) ? SaveSub->LastSaveGameThreadMs : SaveSub->LastLoadGameThreadMs;
+			Sample.WallMs = (PhaseEndSeconds - PhaseStartSeconds) * 1000.0;
+			Sample.BytesWritten = IsSavePhase(Phase) ? SaveSub->LastSaveBytesWritten : 0;
+			Sample.MemoryDeltaBytes = GetUsedPhysical() - PhaseStartUsedPhysical;
+			Sample.Frames = Frames;
+		}
+
+		void Finish()
+		{
+			int32 Checksum = 0;
+			for (const TWeakObjectPtr<ASaveBenchmarkActor>& Actor : Actors)
+			{
+				if (ASaveBenchmarkActor* Live = Actor.Get())
+				{
+					Checksum ^= Live->GetLoadChecksum();
+					SaveSub->UnregisterSaveable(Live);
+					Live->Destroy();
+				}
+			}
+			Actors.Reset();
+
+			SaveSub->SwitchProfile(OriginalSlot);
+			SaveSub->DeleteProfile(ScratchSlot);
+
+			WriteResults(Checksum);
+		}
+
+		void WriteResults(int32 Checksum) const;
+
+		TWeakObjectPtr<UWorld> World;
+		TWeakObjectPtr<USaveSystemSubsystem> SaveSub;
+		FSuiteConfig Config;
+		FString OriginalSlot;
+		TArray<TWeakObjectPtr<ASaveBenchmarkActor>> Actors;
+		TArray<FBenchSample> Samples;
+
+		EBenchPhase Phase = EBenchPhase::SaveSync;
+		int32 Iteration = 0;
+		int32 DirtyCursor = 0;
+		int32 Frames = 0;
+		bool bAwaitingCompletion = false;
+		double PhaseStartSeconds = 0.0;
+		double PhaseEndSeconds = 0.0;
+		int64 PhaseStartUsedPhysical = 0;
+	};
+
+	TSharedPtr<FSaveBenchSuite> GActiveSuite;
+
+	void FSaveBenchSuite::Tick()
+	{
+		if (!IsAlive())
+		{
+			Abort();
+			GActiveSuite.Reset();
+			return;
+		}
+
+		if (IsPhaseInFlight())
+		{
+			++Frames;
+			ScheduleTick();
+			return;
+		}
+		if (bAwaitingCompletion)
+		{
+			// Async wall time resolves to the frame the completion is observed on.
+			PhaseEndSeconds = FPlatformTime::Seconds();
+		}
+
+		EndPhase();
+
+		Phase = static_cast<EBenchPhase>(static_cast<int32>(Phase) + 1);
+		if (Phase == EBenchPhase::Num)
+		{
+			Phase = EBenchPhase::SaveSync;
+			if (++Iteration >= Config.Iterations)
+			{
+				Finish();
+				GActiveSuite.Reset();
+				return;
+			}
+		}
+
+		BeginPhase();
+		ScheduleTick();
+	}
+
+	void FSaveBenchSuite::WriteResults(int32 Checksum) const
+	{
+		const FString Dir = FPaths::ProfilingDir() / TEXT("SaveBench");
+		const FString BaseName = FString::Printf(TEXT("SaveBench_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+
+		FString Csv = TEXT("phase,iteration,game_thread_ms,wall_ms,bytes_written,memory_delta_bytes,frames\n");
+		for (const FBenchSample& Sample : Samples)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%.4f,%.4f,%lld,%lld,%d\n"), GetPhaseName(Sample.Phase), Sample.Iteration,
+				Sample.GameThreadMs, Sample.WallMs, Sample.BytesWritten, Sample.MemoryDeltaBytes, Sample.Frames);
+		}
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		TSharedRef<FJsonObject> JsonConfig = MakeShared<FJsonObject>();
+		JsonConfig->SetNumberField(TEXT("objects"), Config.Objects);
+		JsonConfig->SetNumberField(TEXT("fields"), Config.Fields);
+		JsonConfig->SetNumberField(TEXT("payload_bytes"), Config.PayloadBytes);
+		JsonConfig->SetNumberField(TEXT("guid_ratio"), Config.GuidRatio);
+		JsonConfig->SetNumberField(TEXT("dirty_ratio"), Config.DirtyRatio);
+		JsonConfig->SetNumberField(TEXT("iterations"), Config.Iterations);
+		Root->SetObjectField(TEXT("config"), JsonConfig);
+		Root->SetNumberField(TEXT("load_checksum"), Checksum);
+
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-10s %9s %9s %9s %9s %12s %12s"),
+			TEXT("Phase"), TEXT("GT p50"), TEXT("GT p95"), TEXT("Wall p50"), TEXT("Wall p95"), TEXT("Bytes p50"), TEXT("Mem p50"));
+
+		TSharedRef<FJsonObject> JsonPhases = MakeShared<FJsonObject>();
+		for (int32 PhaseIdx = 0; PhaseIdx < static_cast<int32>(EBenchPhase::Num); ++PhaseIdx)
+		{
+			const EBenchPhase PhaseValue = static_cast<EBenchPhase>(PhaseIdx);
+			TArray<double> GameThread, Wall, Bytes, Memory;
+			for (const FBenchSample& Sample : Samples)
+			{
+				if (Sample.Phase != PhaseValue) continue;
+				GameThread.Add(Sample.GameThreadMs);
+				Wall.Add(Sample.WallMs);
+				Bytes.Add(static_cast<double>(Sample.BytesWritten));
+				Memory.Add(static_cast<double>(Sample.MemoryDeltaBytes));
+			}
+
+			TSharedRef<FJsonObject> JsonPhase = MakeShared<FJsonObject>();
+			JsonPhase->SetNumberField(TEXT("samples"), GameThread.Num());
+			JsonPhase->SetNumberField(TEXT("game_thread_ms_p50"), Percentile(GameThread, 0.50));
+			JsonPhase->SetNumberField(TEXT("game_thread_ms_p95"), Percentile(GameThread, 0.95));
+			JsonPhase->SetNumberField(TEXT("wall_ms_p50"), Percentile(Wall, 0.50));
+			JsonPhase->SetNumberField(TEXT("wall_ms_p95"), Percentile(Wall, 0.95));
+			JsonPhase->SetNumberField(TEXT("bytes_written_p50"), Percentile(Bytes, 0.50));
+			JsonPhase->SetNumberField(TEXT("memory_delta_bytes_p50"), Percentile(Memory, 0.50));
+			JsonPhase->SetNumberField(TEXT("memory_delta_bytes_p95"), Percentile(Memory, 0.95));
+			JsonPhases->SetObjectField(GetPhaseName(PhaseValue), JsonPhase);
+
+			UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] %-10s %9.3f %9.3f %9.3f %9.3f %12.0f %12.0f"),
+				GetPhaseName(PhaseValue), Percentile(GameThread, 0.50), Percentile(GameThread, 0.95),
+				Percentile(Wall, 0.50), Percentile(Wall, 0.95), Percentile(Bytes, 0.50), Percentile(Memory, 0.50));
+		}
+		Root->SetObjectField(TEXT("phases"), JsonPhases);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Root, Writer);
+
+		const FString CsvPath = Dir / (BaseName + TEXT(".csv"));
+		const FString JsonPath = Dir / (BaseName + TEXT(".json"));
+		FFileHelper::SaveStringToFile(Csv, *CsvPath);
+		FFileHelper::SaveStringToFile(Json, *JsonPath);
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveBenchmark] Wrote %s and %s (memory deltas are process-wide; trace with -trace=memory for allocation counts)."),
+			*FPaths::ConvertRelativePathToFull(CsvPath), *FPaths::ConvertRelativePathToFull(JsonPath));
+	}
+
+	void RunSuite(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		USaveSystemSubsystem* SaveSub = GI ? GI->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+		if (!SaveSub || !SaveSub->GetCurrentSaveSystem())
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] No initialised SaveSystemSubsystem in this world."));
+			return;
+		}
+
+		if (GActiveSuite.IsValid())
+		{
+			if (GActiveSuite->IsAlive())
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveBenchmark] A suite is already running."));
+				return;
+			}
+			// Its world was torn down before the next tick.
+			GActiveSuite->Abort();
+			GActiveSuite.Reset();
+		}
+
+		const FString Cmd = FString::Join(Args, TEXT(" "));
+		FSuiteConfig Config;
+		FParse::Value(*Cmd, TEXT("Objects="), Config.Objects);
+		FParse::Value(*Cmd, TEXT("Fields="), Config.Fields);
+		FParse::Value(*Cmd, TEXT("PayloadBytes="), Config.PayloadBytes);
+		FParse::Value(*Cmd, TEXT("GuidRatio="), Config.GuidRatio);
+		FParse::Value(*Cmd, TEXT("DirtyRatio="), Config.DirtyRatio);
+		FParse::Value(*Cmd, TEXT("Iterations="), Config.Iterations);
+		Config.Objects = FMath::Max(0, Config.Objects);
+		Config.Iterations = FMath::Max(1, Config.Iterations);
+
+		TSharedRef<FSaveBenchSuite> Suite = MakeShared<FSaveBenchSuite>(World, SaveSub, Config);
+		if (Suite->Start())
+		{
+			GActiveSuite = Suite;
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs GBenchCompressionCmd(
+		TEXT("FWS.Save.BenchCompression"),
+		TEXT("FWS.Save.BenchCompression [Iterations=20] [Slot=current] - size/time of every slot compression codec."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunCompressionBenchmark));
+
+	FAutoConsoleCommandWithWorldAndArgs GBenchFormatCmd(
+		TEXT("FWS.Save.FormatReport"),
+		TEXT("FWS.Save.FormatReport [Iterations=20] [Slot=current] - slot size and decode time, legacy USaveGame blob vs FWS container."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunFormatReport));
+
+	FAutoConsoleCommandWithArgs GBenchStructCmd(
+		TEXT("FWS.Save.BenchStruct"),
+		TEXT("FWS.Save.BenchStruct [Iterations=1000] [Entries=32] - WriteStruct/ReadStruct vs FJsonObject string for FCharacterProfile."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunStructBenchmark));
+
+	FAutoConsoleCommandWithWorldAndArgs GBenchDispatchCmd(
+		TEXT("FWS.Save.BenchDispatch"),
+		TEXT("FWS.Save.BenchDispatch [Objects=1000] [Iterations=50] - per-object SaveData/LoadData call cost, ProcessEvent vs direct."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunDispatchBenchmark));
+
+	FAutoConsoleCommandWithWorldAndArgs GBenchSuiteCmd(
+		TEXT("FWS.Save.BenchSuite"),
+		TEXT("FWS.Save.BenchSuite [Objects=1000] [Fields=8] [PayloadBytes=64] [GuidRatio=0.5] [DirtyRatio=0.1] [Iterations=10] - synthetic save/load suite, CSV/JSON to Saved/Profiling/SaveBench."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunSuite));
+}
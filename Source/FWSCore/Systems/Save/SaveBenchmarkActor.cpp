@@ -0,0 +1,92 @@
+﻿#include "SaveBenchmarkActor.h"
+#include "SaveSystem.h"
+#include "SaveIdComponent.h"
+
+namespace
+{
+	const FName CounterKey(TEXT("Counter"));
+
+	/** Shared field keys so saves don't build FNames per object. */
+	const TArray<FName>& GetFieldKeys(int32 Count)
+	{
+		static TArray<FName> Keys;
+		for (int32 i = Keys.Num(); i < Count; ++i)
+		{
+			Keys.Add(FName(TEXT("Field"), i + 1));
+		}
+		return Keys;
+	}
+}
+
+ASaveBenchmarkActor::ASaveBenchmarkActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	SetCanBeDamaged(false);
+}
+
+void ASaveBenchmarkActor::Configure(int32 InFieldCount, int32 InPayloadBytes)
+{
+	FieldCount = FMath::Max(0, InFieldCount);
+	PayloadBytes = FMath::Max(0, InPayloadBytes);
+	GetFieldKeys(FieldCount);
+}
+
+void ASaveBenchmarkActor::SaveData_Implementation(USaveSystem* SaveSystem)
+{
+	if (!SaveSystem) return;
+
+	const USaveIdComponent* SaveId = FindComponentByClass<USaveIdComponent>();
+	FSaveObjectData& Data = SaveId && SaveId->HasGuid()
+		? SaveSystem->GetOrCreateObjectByGuid(SaveId->SaveGuid)
+		: SaveSystem->GetOrCreateObject(GetFName());
+
+	int32 SavedCounter = 0;
+	const bool bUnchanged = Data.GetInt(CounterKey, SavedCounter) && SavedCounter == Counter
+		&& Data.BinaryPayload.Num() == PayloadBytes;
+	if (bUnchanged)
+	{
+		return;
+	}
+
+	Data.SetInt(CounterKey, Counter);
+
+	// Mix of the common field types; every value depends on Counter.
+	const TArray<FName>& Keys = GetFieldKeys(FieldCount);
+	for (int32 i = 0; i < FieldCount; ++i)
+	{
+		switch (i % 3)
+		{
+		case 0:  Data.SetInt(Keys[i], Counter + i); break;
+		case 1:  Data.SetFloat(Keys[i], static_cast<float>(Counter) * 0.5f + i); break;
+		default: Data.SetBool(Keys[i], ((Counter + i) & 1) != 0); break;
+		}
+	}
+
+	Data.BinaryPayload.SetNumUninitialized(PayloadBytes);
+	for (int32 i = 0; i < PayloadBytes; ++i)
+	{
+		Data.BinaryPayload[i] = static_cast<uint8>((Counter * 31 + i) & 0xFF);
+	}
+	Data.MarkDirty();
+}
+
+void ASaveBenchmarkActor::LoadData_Implementation(USaveSystem* SaveSystem, const FSaveObjectData& Value)
+{
+	int32 LoadedCounter = 0;
+	Value.GetInt(CounterKey, LoadedCounter);
+
+	const TArray<FName>& Keys = GetFieldKeys(FieldCount);
+	int32 IntValue = 0;
+	float FloatValue = 0.f;
+	bool bBoolValue = false;
+	for (int32 i = 0; i < FieldCount; ++i)
+	{
+		switch (i % 3)
+		{
+		case 0:  Value.GetInt(Keys[i], IntValue); break;
+		case 1:  Value.GetFloat(Keys[i], FloatValue); break;
+		default: Value.GetBool(Keys[i], bBoolValue); break;
+		}
+	}
+	LoadChecksum = LoadedCounter + IntValue + static_cast<int32>(FloatValue) + (bBoolValue ? 1 : 0) + Value.BinaryPayload.Num();
+}
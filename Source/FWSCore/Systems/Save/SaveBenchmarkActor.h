@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Saveable.h"
+#include "SaveBenchmarkActor.generated.h"
+
+/**
+ * Synthetic saveable spawned by FWS.Save.BenchSuite (see SaveBenchmark.cpp).
+ * Writes FieldCount typed fields plus a PayloadBytes binary payload; keyed by GUID when it
+ * carries a USaveIdComponent, by name otherwise. Bumping Counter changes every field.
+ */
+UCLASS(NotPlaceable, Transient)
+class FWSCORE_API ASaveBenchmarkActor : public AActor, public ISaveable
+{
+	GENERATED_BODY()
+
+public:
+	ASaveBenchmarkActor();
+
+	void Configure(int32 InFieldCount, int32 InPayloadBytes);
+
+	/** Marks the object as changed for the next save. */
+	void Mutate() { ++Counter; }
+
+	/** Folded from every field the last LoadData read, so the decode work can't be skipped. */
+	int32 GetLoadChecksum() const { return LoadChecksum; }
+
+	virtual void SaveData_Implementation(USaveSystem* SaveSystem) override;
+	virtual void LoadData_Implementation(USaveSystem* SaveSystem, const FSaveObjectData& Value) override;
+
+private:
+	int32 FieldCount = 0;
+	int32 PayloadBytes = 0;
+	int32 Counter = 0;
+	int32 LoadChecksum = 0;
+};
@@ -0,0 +1,367 @@
+﻿#include "SaveCloudBackend.h"
+#include "FWSCore.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <eos_playerdatastorage.h>
+
+/* ---------- EOS Player Data Storage ---------- */
+
+struct FSaveCloudEOSBackend::FTransfer
+{
+	TSharedRef<bool, ESPMode::ThreadSafe> Alive;
+	TArray<uint8> Bytes;
+	int64 Cursor = 0;
+	FOnProgress OnProgress;
+	FOnRead OnRead;
+	FOnDone OnDone;
+	EOS_HPlayerDataStorageFileTransferRequest Request = nullptr;
+
+	explicit FTransfer(const TSharedRef<bool, ESPMode::ThreadSafe>& InAlive) : Alive(InAlive) {}
+};
+
+namespace
+{
+	using FTransfer = FSaveCloudEOSBackend::FTransfer;
+
+	ESaveCloudResult ToCloudResult(EOS_EResult Result)
+	{
+		switch (Result)
+		{
+		case EOS_EResult::EOS_Success:  return ESaveCloudResult::Success;
+		case EOS_EResult::EOS_NotFound: return ESaveCloudResult::NotFound;
+		case EOS_EResult::EOS_Canceled: return ESaveCloudResult::Cancelled;
+		default:                        return ESaveCloudResult::Failed;
+		}
+	}
+
+	EOS_PlayerDataStorage_EReadResult EOS_CALL OnReadData(const EOS_PlayerDataStorage_ReadFileDataCallbackInfo* Info)
+	{
+		FTransfer* T = static_cast<FTransfer*>(Info->ClientData);
+		if (!*T->Alive) return EOS_PlayerDataStorage_EReadResult::EOS_RR_CancelRequest;
+
+		if (T->Bytes.Num() == 0)
+		{
+			T->Bytes.Reserve(static_cast<int32>(Info->TotalFileSizeBytes));
+		}
+		T->Bytes.Append(static_cast<const uint8*>(Info->DataChunk), static_cast<int32>(Info->DataChunkLengthBytes));
+		return EOS_PlayerDataStorage_EReadResult::EOS_RR_ContinueReading;
+	}
+
+	EOS_PlayerDataStorage_EWriteResult EOS_CALL OnWriteData(const EOS_PlayerDataStorage_WriteFileDataCallbackInfo* Info, void* OutDataBuffer, uint32_t* OutDataWritten)
+	{
+		FTransfer* T = static_cast<FTransfer*>(Info->ClientData);
+		if (!*T->Alive)
+		{
+			*OutDataWritten = 0;
+			return EOS_PlayerDataStorage_EWriteResult::EOS_WR_CancelRequest;
+		}
+
+		const int64 Remaining = T->Bytes.Num() - T->Cursor;
+		const uint32 Count = static_cast<uint32>(FMath::Min<int64>(Remaining, Info->DataBufferLengthBytes));
+		if (Count > 0)
+		{
+			FMemory::Memcpy(OutDataBuffer, T->Bytes.GetData() + T->Cursor, Count);
+		}
+		T->Cursor += Count;
+		*OutDataWritten = Count;
+
+		return T->Cursor >= T->Bytes.Num()
+			? EOS_PlayerDataStorage_EWriteResult::EOS_WR_CompleteRequest
+			: EOS_PlayerDataStorage_EWriteResult::EOS_WR_ContinueWriting;
+	}
+
+	void EOS_CALL OnTransferProgress(const EOS_PlayerDataStorage_FileTransferProgressCallbackInfo* Info)
+	{
+		FTransfer* T = static_cast<FTransfer*>(Info->ClientData);
+		if (*T->Alive && T->OnProgress)
+		{
+			T->OnProgress(Info->BytesTransferred, Info->TotalFileSizeBytes);
+		}
+	}
+
+	/** EOS always delivers the completion callback exactly once, so the transfer is freed here. */
+	void EOS_CALL OnReadComplete(const EOS_PlayerDataStorage_ReadFileCallbackInfo* Info)
+	{
+		TUniquePtr<FTransfer> T(static_cast<FTransfer*>(Info->ClientData));
+		if (T->Request) EOS_PlayerDataStorageFileTransferRequest_Release(T->Request);
+		if (*T->Alive && T->OnRead)
+		{
+			const ESaveCloudResult Result = ToCloudResult(Info->ResultCode);
+			T->OnRead(Result, Result == ESaveCloudResult::Success ? MoveTemp(T->Bytes) : TArray<uint8>());
+		}
+	}
+
+	void EOS_CALL OnWriteComplete(const EOS_PlayerDataStorage_WriteFileCallbackInfo* Info)
+	{
+		TUniquePtr<FTransfer> T(static_cast<FTransfer*>(Info->ClientData));
+		if (T->Request) EOS_PlayerDataStorageFileTransferRequest_Release(T->Request);
+		if (*T->Alive && T->OnDone)
+		{
+			T->OnDone(ToCloudResult(Info->ResultCode));
+		}
+	}
+
+	void EOS_CALL OnDeleteComplete(const EOS_PlayerDataStorage_DeleteFileCallbackInfo* Info)
+	{
+		TUniquePtr<FTransfer> T(static_cast<FTransfer*>(Info->ClientData));
+		if (*T->Alive && T->OnDone)
+		{
+			T->OnDone(ToCloudResult(Info->ResultCode));
+		}
+	}
+}
+
+FSaveCloudEOSBackend::FSaveCloudEOSBackend(EOS_HPlatform InPlatform, EOS_ProductUserId InLocalUserId)
+	: Storage(InPlatform ? EOS_Platform_GetPlayerDataStorageInterface(InPlatform) : nullptr)
+	, LocalUserId(InLocalUserId)
+	, Alive(MakeShared<bool, ESPMode::ThreadSafe>(true))
+{
+}
+
+FSaveCloudEOSBackend::~FSaveCloudEOSBackend()
+{
+	*Alive = false;
+}
+
+void FSaveCloudEOSBackend::ReadFile(const FString& Name, int32 PartBytes, FOnProgress OnProgress, FOnRead OnComplete)
+{
+	if (!Storage || !LocalUserId)
+	{
+		if (OnComplete) OnComplete(ESaveCloudResult::Unavailable, TArray<uint8>());
+		return;
+	}
+
+	FTransfer* T = new FTransfer(Alive);
+	T->OnProgress = MoveTemp(OnProgress);
+	T->OnRead = MoveTemp(OnComplete);
+
+	const FTCHARToUTF8 Filename(*Name);
+	EOS_PlayerDataStorage_ReadFileOptions Options{};
+	Options.ApiVersion = EOS_PLAYERDATASTORAGE_READFILE_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.Filename = Filename.Get();
+	Options.ReadChunkLengthBytes = static_cast<uint32_t>(FMath::Max(PartBytes, 1));
+	Options.ReadFileDataCallback = &OnReadData;
+	Options.FileTransferProgressCallback = &OnTransferProgress;
+
+	T->Request = EOS_PlayerDataStorage_ReadFile(Storage, &Options, T, &OnReadComplete);
+}
+
+void FSaveCloudEOSBackend::WriteFile(const FString& Name, TArray<uint8>&& Bytes, int32 PartBytes, FOnProgress OnProgress, FOnDone OnComplete)
+{
+	if (!Storage || !LocalUserId)
+	{
+		if (OnComplete) OnComplete(ESaveCloudResult::Unavailable);
+		return;
+	}
+
+	FTransfer* T = new FTransfer(Alive);
+	T->Bytes = MoveTemp(Bytes);
+	T->OnProgress = MoveTemp(OnProgress);
+	T->OnDone = MoveTemp(OnComplete);
+
+	const FTCHARToUTF8 Filename(*Name);
+	EOS_PlayerDataStorage_WriteFileOptions Options{};
+	Options.ApiVersion = EOS_PLAYERDATASTORAGE_WRITEFILE_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.Filename = Filename.Get();
+	Options.ChunkLengthBytes = static_cast<uint32_t>(FMath::Max(PartBytes, 1));
+	Options.WriteFileDataCallback = &OnWriteData;
+	Options.FileTransferProgressCallback = &OnTransferProgress;
+
+	T->Request = EOS_PlayerDataStorage_WriteFile(Storage, &Options, T, &OnWriteComplete);
+}
+
+void FSaveCloudEOSBackend::DeleteFile(const FString& Name, FOnDone OnComplete)
+{
+	if (!Storage || !LocalUserId)
+	{
+		if (OnComplete) OnComplete(ESaveCloudResult::Unavailable);
+		return;
+	}
+
+	FTransfer* T = new FTransfer(Alive);
+	T->OnDone = MoveTemp(OnComplete);
+
+	const FTCHARToUTF8 Filename(*Name);
+	EOS_PlayerDataStorage_DeleteFileOptions Options{};
+	Options.ApiVersion = EOS_PLAYERDATASTORAGE_DELETEFILE_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.Filename = Filename.Get();
+
+	EOS_PlayerDataStorage_DeleteFile(Storage, &Options, T, &OnDeleteComplete);
+}
+
+void FSaveCloudEOSBackend::CancelAll()
+{
+	// Running transfers see the old flag and cancel themselves at their next data callback.
+	*Alive = false;
+	Alive = MakeShared<bool, ESPMode::ThreadSafe>(true);
+}
+
+/* ---------- Local fake ---------- */
+
+FSaveCloudFakeBackend::FSaveCloudFakeBackend(const FString& InDirectory, float InLatencyMs, int64 InBandwidthBytesPerSecond)
+	: Directory(InDirectory)
+	, LatencyMs(FMath::Max(InLatencyMs, 0.f))
+	, BandwidthBytesPerSecond(FMath::Max<int64>(InBandwidthBytesPerSecond, 0))
+{
+	IFileManager::Get().MakeDirectory(*Directory, true);
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSaveCloudFakeBackend::Tick));
+}
+
+FSaveCloudFakeBackend::~FSaveCloudFakeBackend()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+}
+
+FString FSaveCloudFakeBackend::GetPath(const FString& Name) const
+{
+	return Directory / Name;
+}
+
+void FSaveCloudFakeBackend::Enqueue(TUniquePtr<FOp> Op)
+{
+	// StartAt 0 = not at the front yet; Tick starts its latency when it gets there.
+	Op->StartAt = Queue.Num() > 0 ? 0.0 : FPlatformTime::Seconds() + LatencyMs / 1000.0;
+	Queue.Add(MoveTemp(Op));
+}
+
+void FSaveCloudFakeBackend::ReadFile(const FString& Name, int32 PartBytes, FOnProgress OnProgress, FOnRead OnComplete)
+{
+	TUniquePtr<FOp> Op = MakeUnique<FOp>();
+	Op->Kind = FOp::EKind::Read;
+	Op->Name = Name;
+	Op->PartBytes = FMath::Max(PartBytes, 1);
+	Op->OnProgress = MoveTemp(OnProgress);
+	Op->OnRead = MoveTemp(OnComplete);
+	Enqueue(MoveTemp(Op));
+}
+
+void FSaveCloudFakeBackend::WriteFile(const FString& Name, TArray<uint8>&& Bytes, int32 PartBytes, FOnProgress OnProgress, FOnDone OnComplete)
+{
+	TUniquePtr<FOp> Op = MakeUnique<FOp>();
+	Op->Kind = FOp::EKind::Write;
+	Op->Name = Name;
+	Op->Bytes = MoveTemp(Bytes);
+	Op->PartBytes = FMath::Max(PartBytes, 1);
+	Op->OnProgress = MoveTemp(OnProgress);
+	Op->OnDone = MoveTemp(OnComplete);
+	Enqueue(MoveTemp(Op));
+}
+
+void FSaveCloudFakeBackend::DeleteFile(const FString& Name, FOnDone OnComplete)
+{
+	TUniquePtr<FOp> Op = MakeUnique<FOp>();
+	Op->Kind = FOp::EKind::Delete;
+	Op->Name = Name;
+	Op->OnDone = MoveTemp(OnComplete);
+	Enqueue(MoveTemp(Op));
+}
+
+void FSaveCloudFakeBackend::CancelAll()
+{
+	++CancelGeneration;
+	Queue.Reset();
+}
+
+bool FSaveCloudFakeBackend::Start(FOp& Op)
+{
+	Op.bStarted = true;
+	switch (Op.Kind)
+	{
+	case FOp::EKind::Read:
+		if (!FFileHelper::LoadFileToArray(Op.Bytes, *GetPath(Op.Name), FILEREAD_Silent))
+		{
+			if (Op.OnRead) Op.OnRead(ESaveCloudResult::NotFound, TArray<uint8>());
+			return false;
+		}
+		return true;
+
+	case FOp::EKind::Delete:
+	{
+		const FString Path = GetPath(Op.Name);
+		const bool bExisted = IFileManager::Get().FileExists(*Path);
+		const bool bDeleted = !bExisted || IFileManager::Get().Delete(*Path, false, true, true);
+		if (Op.OnDone)
+		{
+			Op.OnDone(!bExisted ? ESaveCloudResult::NotFound : bDeleted ? ESaveCloudResult::Success : ESaveCloudResult::Failed);
+		}
+		return false;
+	}
+
+	default:
+		return true;
+	}
+}
+
+void FSaveCloudFakeBackend::Complete(FOp& Op)
+{
+	if (Op.Kind == FOp::EKind::Read)
+	{
+		if (Op.OnRead) Op.OnRead(ESaveCloudResult::Success, MoveTemp(Op.Bytes));
+		return;
+	}
+
+	// Same temp + rename as the slot files, so a killed process never leaves a half-written "remote" file.
+	const FString Path = GetPath(Op.Name);
+	const FString TempPath = Path + TEXT(".tmp");
+	const bool bOk = FFileHelper::SaveArrayToFile(Op.Bytes, *TempPath)
+		&& IFileManager::Get().Move(*Path, *TempPath, true, true);
+	if (!bOk)
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveCloudBackend] Fake backend failed to write '%s'"), *Path);
+	}
+	if (Op.OnDone) Op.OnDone(bOk ? ESaveCloudResult::Success : ESaveCloudResult::Failed);
+}
+
+bool FSaveCloudFakeBackend::Tick(float DeltaSeconds)
+{
+	if (Queue.Num() == 0) return true;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Queue[0]->StartAt == 0.0)
+	{
+		// Queued behind another op; its latency starts once it reaches the front.
+		Queue[0]->StartAt = Now + LatencyMs / 1000.0;
+	}
+	if (Now < Queue[0]->StartAt) return true;
+
+	// Callbacks may queue or cancel ops, so the op is held outside the queue while they run.
+	TUniquePtr<FOp> Op = MoveTemp(Queue[0]);
+	Queue.RemoveAt(0, 1, EAllowShrinking::No);
+	const uint32 Generation = CancelGeneration;
+
+	if (!Op->bStarted && !Start(*Op)) return true;
+
+	const int64 Total = Op->Bytes.Num();
+	double Allowance = BandwidthBytesPerSecond > 0
+		? Op->Budget + static_cast<double>(BandwidthBytesPerSecond) * DeltaSeconds
+		: static_cast<double>(Total);
+
+	while (Op->Transferred < Total)
+	{
+		const int64 Part = FMath::Min<int64>(Op->PartBytes, Total - Op->Transferred);
+		if (Allowance < static_cast<double>(Part)) break;
+
+		Allowance -= static_cast<double>(Part);
+		Op->Transferred += Part;
+		if (Op->OnProgress)
+		{
+			Op->OnProgress(Op->Transferred, Total);
+			if (Generation != CancelGeneration) return true;
+		}
+	}
+
+	if (Op->Transferred >= Total)
+	{
+		Complete(*Op);
+		return true;
+	}
+
+	Op->Budget = Allowance;
+	Queue.Insert(MoveTemp(Op), 0);
+	return true;
+}
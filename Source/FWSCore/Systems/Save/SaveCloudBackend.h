@@ -0,0 +1,134 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include <eos_sdk.h>
+#include "SaveCloudBackend.generated.h"
+
+/** Which service cloud sync talks to. */
+UENUM(BlueprintType)
+enum class ESaveCloudBackend : uint8
+{
+	None,
+	/** EOS Player Data Storage of the logged-in product user. */
+	EOS,
+	/** Directory under Saved/ with simulated latency and bandwidth (offline CI, tests). */
+	LocalFake
+};
+
+/** Outcome of a cloud file operation or of a whole sync. */
+UENUM(BlueprintType)
+enum class ESaveCloudResult : uint8
+{
+	Success,
+	NotFound,
+	/** Another device uploaded since this one last synced; upload again with bForce to overwrite. */
+	Conflict,
+	/** No backend, or not logged in. */
+	Unavailable,
+	Cancelled,
+	Failed
+};
+
+/**
+ * Per-user remote file store used by cloud save sync.
+ * Transfers stream in parts of at most PartBytes and report progress per part.
+ * Every call and callback happens on the game thread; one backend instance serves one user.
+ */
+class FWSCORE_API ISaveCloudBackend
+{
+public:
+	using FOnProgress = TFunction<void(int64 BytesTransferred, int64 TotalBytes)>;
+	using FOnRead = TFunction<void(ESaveCloudResult Result, TArray<uint8>&& Bytes)>;
+	using FOnDone = TFunction<void(ESaveCloudResult Result)>;
+
+	virtual ~ISaveCloudBackend() = default;
+
+	virtual void ReadFile(const FString& Name, int32 PartBytes, FOnProgress OnProgress, FOnRead OnComplete) = 0;
+	virtual void WriteFile(const FString& Name, TArray<uint8>&& Bytes, int32 PartBytes, FOnProgress OnProgress, FOnDone OnComplete) = 0;
+	virtual void DeleteFile(const FString& Name, FOnDone OnComplete) = 0;
+
+	/** Drops callbacks of transfers still running (they complete or fail on their own). */
+	virtual void CancelAll() = 0;
+
+	/** Longest file name the service accepts. */
+	virtual int32 GetMaxFileNameLength() const { return 64; }
+};
+
+/** EOS Player Data Storage. Requires a Connect login (product user id). */
+class FWSCORE_API FSaveCloudEOSBackend final : public ISaveCloudBackend
+{
+public:
+	FSaveCloudEOSBackend(EOS_HPlatform InPlatform, EOS_ProductUserId InLocalUserId);
+	virtual ~FSaveCloudEOSBackend() override;
+
+	virtual void ReadFile(const FString& Name, int32 PartBytes, FOnProgress OnProgress, FOnRead OnComplete) override;
+	virtual void WriteFile(const FString& Name, TArray<uint8>&& Bytes, int32 PartBytes, FOnProgress OnProgress, FOnDone OnComplete) override;
+	virtual void DeleteFile(const FString& Name, FOnDone OnComplete) override;
+	virtual void CancelAll() override;
+
+	struct FTransfer;
+
+private:
+	EOS_HPlayerDataStorage Storage = nullptr;
+	EOS_ProductUserId LocalUserId = nullptr;
+
+	/** Shared with the SDK's ClientData so a callback arriving after CancelAll/destruction is ignored. */
+	TSharedRef<bool, ESPMode::ThreadSafe> Alive;
+};
+
+/**
+ * Stand-in service backed by a local directory, for machines without network.
+ * Every operation waits LatencyMs, then moves at most BandwidthBytesPerSecond (0 = unlimited) in PartBytes steps.
+ */
+class FWSCORE_API FSaveCloudFakeBackend final : public ISaveCloudBackend
+{
+public:
+	FSaveCloudFakeBackend(const FString& InDirectory, float InLatencyMs, int64 InBandwidthBytesPerSecond);
+	virtual ~FSaveCloudFakeBackend() override;
+
+	virtual void ReadFile(const FString& Name, int32 PartBytes, FOnProgress OnProgress, FOnRead OnComplete) override;
+	virtual void WriteFile(const FString& Name, TArray<uint8>&& Bytes, int32 PartBytes, FOnProgress OnProgress, FOnDone OnComplete) override;
+	virtual void DeleteFile(const FString& Name, FOnDone OnComplete) override;
+	virtual void CancelAll() override;
+
+	const FString& GetDirectory() const { return Directory; }
+
+private:
+	struct FOp
+	{
+		enum class EKind : uint8 { Read, Write, Delete };
+
+		EKind Kind = EKind::Read;
+		FString Name;
+		TArray<uint8> Bytes;
+		int64 Transferred = 0;
+		int32 PartBytes = 0;
+		double StartAt = 0.0;
+		double Budget = 0.0;
+		bool bStarted = false;
+		FOnProgress OnProgress;
+		FOnRead OnRead;
+		FOnDone OnDone;
+	};
+
+	bool Tick(float DeltaSeconds);
+
+	/** Runs after the op's latency: loads a read's file. False if the op already finished (missing file, delete). */
+	bool Start(FOp& Op);
+
+	void Enqueue(TUniquePtr<FOp> Op);
+	void Complete(FOp& Op);
+	FString GetPath(const FString& Name) const;
+
+	FString Directory;
+	float LatencyMs = 0.f;
+	int64 BandwidthBytesPerSecond = 0;
+
+	/** Operations run one after another, like a single network connection. */
+	TArray<TUniquePtr<FOp>> Queue;
+
+	/** Bumped by CancelAll so an op whose callback cancelled everything isn't put back. */
+	uint32 CancelGeneration = 0;
+	FTSTicker::FDelegateHandle TickHandle;
+};
@@ -0,0 +1,762 @@
+﻿#include "SaveCloudSync.h"
+#include "FWSCore.h"
+#include "SaveSlotFormat.h"
+#include "SaveSlotStorage.h"
+#include "SaveJournal.h"
+#include "Async/Async.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+	/** 'FWSM' */
+	constexpr uint32 ManifestMagic = 0x4D535746;
+	constexpr int32 ManifestVersion = 1;
+
+	/** 256 pseudo-random words for the Gear hash; fixed seed so every device cuts at the same places. */
+	struct FGearTable
+	{
+		uint64 Words[256];
+
+		FGearTable()
+		{
+			uint64 State = 0x46575353AD5EC10DULL;
+			for (uint64& Word : Words)
+			{
+				// splitmix64
+				State += 0x9E3779B97F4A7C15ULL;
+				uint64 Z = State;
+				Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBULL;
+				Word = Z ^ (Z >> 31);
+			}
+		}
+	};
+
+	FSHAHash HashBytes(TConstArrayView<uint8> Bytes)
+	{
+		FSHAHash Hash;
+		FSHA1::HashBuffer(Bytes.GetData(), Bytes.Num(), Hash.Hash);
+		return Hash;
+	}
+
+	void SerializeFiles(FArchive& Ar, TArray<SaveCloudSync::FFileEntry>& Files)
+	{
+		int32 NumFiles = Files.Num();
+		Ar << NumFiles;
+		if (Ar.IsLoading())
+		{
+			if (NumFiles < 0 || NumFiles > Ar.TotalSize())
+			{
+				Ar.SetError();
+				return;
+			}
+			Files.SetNum(NumFiles);
+		}
+
+		for (SaveCloudSync::FFileEntry& File : Files)
+		{
+			Ar << File.Suffix;
+			Ar << File.Size;
+			Ar << File.Hash;
+
+			int32 NumChunks = File.Chunks.Num();
+			Ar << NumChunks;
+			if (Ar.IsLoading())
+			{
+				if (NumChunks < 0 || NumChunks > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					return;
+				}
+				File.Chunks.SetNum(NumChunks);
+			}
+			for (SaveCloudSync::FChunkRef& Chunk : File.Chunks)
+			{
+				Ar << Chunk.Hash;
+				Ar << Chunk.Size;
+				Ar << Chunk.StoredSize;
+			}
+			if (Ar.IsError()) return;
+		}
+	}
+
+	FString GetLastSyncedPath(const FString& Slot)
+	{
+		return FPaths::GetPath(SaveSlotStorage::GetSlotPath(Slot)) / (Slot + TEXT(".cloudsync"));
+	}
+
+	/** Slot image as uploaded: journal folded in, uncompressed current format. Legacy USaveGame blobs go up as they are. */
+	bool ReadCanonicalImage(const FString& Slot, TArray<uint8>& OutBytes)
+	{
+		TArray<uint8> Bytes;
+		FSaveSnapshot Snapshot;
+		{
+			FScopeLock Lock(&SaveJournal::GetSlotLock(Slot));
+			if (!SaveSlotStorage::ReadNewestValid(Slot, Bytes))
+			{
+				return false;
+			}
+			if (!SaveSlotFormat::IsContainer(Bytes))
+			{
+				OutBytes = MoveTemp(Bytes);
+				return true;
+			}
+			if (!SaveSlotFormat::Read(Bytes, Snapshot))
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveCloudSync] Skipping %s: corrupt or from a newer build."), *Slot);
+				return false;
+			}
+			SaveJournal::Replay(Slot, Snapshot);
+		}
+
+		// Compression would turn a one-object edit into a whole-file change.
+		SaveSlotFormat::Write(Snapshot, OutBytes, SaveSlotFormat::FEncodeOptions());
+		return true;
+	}
+}
+
+namespace SaveCloudSync
+{
+	/* ---------- Manifest ---------- */
+
+	FSHAHash FManifest::GetContentHash() const
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar(Bytes, /*bIsPersistent*/true);
+		SerializeFiles(Ar, const_cast<TArray<FFileEntry>&>(Files));
+		return HashBytes(Bytes);
+	}
+
+	void FManifest::Write(TArray<uint8>& OutBytes) const
+	{
+		OutBytes.Reset();
+		FMemoryWriter Ar(OutBytes, /*bIsPersistent*/true);
+
+		uint32 Magic = ManifestMagic;
+		int32 Version = ManifestVersion;
+		int64 Ticks = Timestamp.GetTicks();
+		Ar << Magic;
+		Ar << Version;
+		Ar << Ticks;
+		SerializeFiles(Ar, const_cast<TArray<FFileEntry>&>(Files));
+	}
+
+	bool FManifest::Read(TConstArrayView<uint8> Bytes)
+	{
+		FMemoryReaderView Ar(Bytes, /*bIsPersistent*/true);
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		int64 Ticks = 0;
+		Ar << Magic;
+		Ar << Version;
+		if (Ar.IsError() || Magic != ManifestMagic || Version <= 0 || Version > ManifestVersion)
+		{
+			return false;
+		}
+		Ar << Ticks;
+		Timestamp = FDateTime(Ticks);
+		SerializeFiles(Ar, Files);
+		return !Ar.IsError();
+	}
+
+	/* ---------- Chunking ---------- */
+
+	void SplitChunks(TConstArrayView<uint8> Bytes, TArray<int32>& OutEnds)
+	{
+		static const FGearTable Gear;
+
+		// Top bits of the hash mix best; one cut per AvgChunkSize bytes on average.
+		const int32 MaskBits = FMath::FloorLog2(static_cast<uint32>(AvgChunkSize));
+		const uint64 CutMask = ((1ULL << MaskBits) - 1) << (64 - MaskBits);
+
+		OutEnds.Reset();
+		const int32 Num = Bytes.Num();
+		int32 Start = 0;
+		while (Start < Num)
+		{
+			if (Num - Start <= MinChunkSize)
+			{
+				OutEnds.Add(Num);
+				break;
+			}
+
+			const int32 Limit = Start + FMath::Min(Num - Start, MaxChunkSize);
+			int32 Cut = Limit;
+			uint64 Hash = 0;
+
+			// A Gear hash only depends on the last 64 bytes, so it warms up right before the first allowed cut.
+			for (int32 i = Start + MinChunkSize - 64; i < Limit; ++i)
+			{
+				Hash = (Hash << 1) + Gear.Words[Bytes[i]];
+				if (i + 1 >= Start + MinChunkSize && (Hash & CutMask) == 0)
+				{
+					Cut = i + 1;
+					break;
+				}
+			}
+
+			OutEnds.Add(Cut);
+			Start = Cut;
+		}
+	}
+
+	void EncodeChunk(TConstArrayView<uint8> Raw, TArray<uint8>& OutEncoded)
+	{
+		const int32 RawSize = Raw.Num();
+		const int32 HeaderSize = sizeof(uint8) + sizeof(int32);
+
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, RawSize);
+		OutEncoded.SetNumUninitialized(HeaderSize + CompressedSize);
+
+		uint8 Codec = static_cast<uint8>(ESaveCompressionCodec::None);
+		if (RawSize > 0
+			&& FCompression::CompressMemory(NAME_Zlib, OutEncoded.GetData() + HeaderSize, CompressedSize, Raw.GetData(), RawSize, COMPRESS_BiasSize)
+			&& CompressedSize < RawSize)
+		{
+			Codec = static_cast<uint8>(ESaveCompressionCodec::Zlib);
+			OutEncoded.SetNum(HeaderSize + CompressedSize, EAllowShrinking::No);
+		}
+		else
+		{
+			OutEncoded.SetNum(HeaderSize + RawSize, EAllowShrinking::No);
+			FMemory::Memcpy(OutEncoded.GetData() + HeaderSize, Raw.GetData(), RawSize);
+		}
+
+		OutEncoded[0] = Codec;
+		FMemory::Memcpy(OutEncoded.GetData() + sizeof(uint8), &RawSize, sizeof(int32));
+	}
+
+	bool DecodeChunk(TConstArrayView<uint8> Encoded, TArray<uint8>& OutRaw)
+	{
+		const int32 HeaderSize = sizeof(uint8) + sizeof(int32);
+		if (Encoded.Num() < HeaderSize) return false;
+
+		const uint8 Codec = Encoded[0];
+		int32 RawSize = 0;
+		FMemory::Memcpy(&RawSize, Encoded.GetData() + sizeof(uint8), sizeof(int32));
+		if (RawSize < 0 || RawSize > MaxChunkSize) return false;
+
+		const uint8* Data = Encoded.GetData() + HeaderSize;
+		const int32 DataSize = Encoded.Num() - HeaderSize;
+		OutRaw.SetNumUninitialized(RawSize);
+
+		if (Codec == static_cast<uint8>(ESaveCompressionCodec::None))
+		{
+			if (DataSize != RawSize) return false;
+			FMemory::Memcpy(OutRaw.GetData(), Data, RawSize);
+			return true;
+		}
+		return Codec == static_cast<uint8>(ESaveCompressionCodec::Zlib)
+			&& FCompression::UncompressMemory(NAME_Zlib, OutRaw.GetData(), RawSize, Data, DataSize);
+	}
+
+	/* ---------- Names and sync state ---------- */
+
+	FString GetManifestName(const FString& Slot, int32 MaxLength)
+	{
+		const FString Name = TEXT("m_") + Slot;
+		if (Name.Len() <= MaxLength)
+		{
+			return Name;
+		}
+		return TEXT("m_") + FSHA1::HashBuffer(*Slot, Slot.Len() * sizeof(TCHAR)).ToString();
+	}
+
+	FString GetChunkPrefix(const FString& Slot, int32 MaxLength)
+	{
+		const FString Prefix = TEXT("c_") + Slot + TEXT("_");
+		if (Prefix.Len() + 40 <= MaxLength)
+		{
+			return Prefix;
+		}
+		// 64 bits of the slot hash keep the name within the 64 characters EOS allows.
+		return TEXT("c_") + FSHA1::HashBuffer(*Slot, Slot.Len() * sizeof(TCHAR)).ToString().Left(16) + TEXT("_");
+	}
+
+	FString GetChunkName(const FString& Prefix, const FSHAHash& Hash)
+	{
+		return Prefix + Hash.ToString();
+	}
+
+	bool LoadLastSynced(const FString& Slot, FSHAHash& OutHash)
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *GetLastSyncedPath(Slot), FFileHelper::EHashOptions::None, FILEREAD_Silent))
+		{
+			return false;
+		}
+		Text.TrimStartAndEndInline();
+		if (Text.Len() != 40) return false;
+		OutHash.FromString(Text);
+		return true;
+	}
+
+	void SaveLastSynced(const FString& Slot, const FSHAHash& Hash)
+	{
+		FFileHelper::SaveStringToFile(Hash.ToString(), *GetLastSyncedPath(Slot));
+	}
+
+	void ClearLastSynced(const FString& Slot)
+	{
+		IFileManager::Get().Delete(*GetLastSyncedPath(Slot), false, false, true);
+	}
+
+	/* ---------- Local files ---------- */
+
+	void CollectLocal(const FString& Slot, bool bEncodeChunks, FLocalState& Out)
+	{
+		// Sorted so the manifest (and its content hash) doesn't depend on directory order.
+		TArray<FString> Slots;
+		SaveSlotStorage::FindChunkSlots(Slot, Slots);
+		Slots.Sort();
+		Slots.Insert(Slot, 0);
+
+		TArray<int32> Ends;
+		for (const FString& FileSlot : Slots)
+		{
+			TArray<uint8> Bytes;
+			if (!ReadCanonicalImage(FileSlot, Bytes))
+			{
+				continue;
+			}
+
+			const int32 FileIndex = Out.Files.Num();
+			FSyncFile& File = Out.Files.AddDefaulted_GetRef();
+			File.Suffix = FileSlot.RightChop(Slot.Len());
+			File.Bytes = MoveTemp(Bytes);
+
+			FFileEntry& Entry = Out.Manifest.Files.AddDefaulted_GetRef();
+			Entry.Suffix = File.Suffix;
+			Entry.Size = File.Bytes.Num();
+			Entry.Hash = HashBytes(File.Bytes);
+
+			SplitChunks(File.Bytes, Ends);
+			int32 Offset = 0;
+			for (const int32 End : Ends)
+			{
+				const TConstArrayView<uint8> Raw(File.Bytes.GetData() + Offset, End - Offset);
+
+				FChunkRef& Chunk = Entry.Chunks.AddDefaulted_GetRef();
+				Chunk.Hash = HashBytes(Raw);
+				Chunk.Size = Raw.Num();
+				Chunk.StoredSize = Raw.Num();
+
+				if (!Out.Chunks.Contains(Chunk.Hash))
+				{
+					Out.Chunks.Add(Chunk.Hash, FLocalState::FLocation{ FileIndex, Offset, Raw.Num() });
+				}
+				if (bEncodeChunks)
+				{
+					TArray<uint8>* Encoded = Out.Encoded.Find(Chunk.Hash);
+					if (!Encoded)
+					{
+						Encoded = &Out.Encoded.Add(Chunk.Hash);
+						EncodeChunk(Raw, *Encoded);
+					}
+					Chunk.StoredSize = Encoded->Num();
+				}
+				Offset = End;
+			}
+		}
+
+		Out.Manifest.Timestamp = FDateTime::UtcNow();
+	}
+}
+
+/* ---------- Sync operation ---------- */
+
+FSaveCloudSyncOp::FSaveCloudSyncOp(const TSharedRef<ISaveCloudBackend>& InBackend, const FString& InSlot, bool bInUpload, bool bInForce, int32 InPartBytes)
+	: Backend(InBackend)
+	, Slot(InSlot)
+	, ManifestName(SaveCloudSync::GetManifestName(InSlot, InBackend->GetMaxFileNameLength()))
+	, ChunkPrefix(SaveCloudSync::GetChunkPrefix(InSlot, InBackend->GetMaxFileNameLength()))
+	, bUpload(bInUpload)
+	, bForce(bInForce)
+	, PartBytes(FMath::Max(InPartBytes, 1024))
+	, Local(MakeShared<SaveCloudSync::FLocalState, ESPMode::ThreadSafe>())
+	, Downloaded(MakeShared<TMap<FSHAHash, TArray<uint8>>, ESPMode::ThreadSafe>())
+{
+}
+
+void FSaveCloudSyncOp::Start(const UE::Tasks::FTask& Prerequisite)
+{
+	bRunning = true;
+
+	const TSharedRef<SaveCloudSync::FLocalState, ESPMode::ThreadSafe> State = Local;
+	const TWeakPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> WeakThis = AsShared();
+	const FString LocalSlot = Slot;
+	const bool bEncode = bUpload;
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [State, WeakThis, LocalSlot, bEncode]()
+	{
+		SaveCloudSync::CollectLocal(LocalSlot, bEncode, *State);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin())
+			{
+				Self->OnLocalCollected();
+			}
+		});
+	}, UE::Tasks::Prerequisites(Prerequisite));
+}
+
+void FSaveCloudSyncOp::Cancel()
+{
+	Finish(ESaveCloudResult::Cancelled);
+}
+
+void FSaveCloudSyncOp::OnLocalCollected()
+{
+	if (!bRunning) return;
+
+	const TWeakPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Backend->ReadFile(ManifestName, PartBytes, nullptr, [WeakThis](ESaveCloudResult Result, TArray<uint8>&& Bytes)
+	{
+		if (const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin())
+		{
+			Self->OnRemoteManifest(Result, MoveTemp(Bytes));
+		}
+	});
+}
+
+void FSaveCloudSyncOp::OnRemoteManifest(ESaveCloudResult Result, TArray<uint8>&& Bytes)
+{
+	if (!bRunning) return;
+
+	if (Result == ESaveCloudResult::Success)
+	{
+		bHasRemote = Remote.Read(Bytes);
+		if (!bHasRemote)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveCloudSync] %s: remote manifest is damaged or from a newer build."), *Slot);
+			Finish(ESaveCloudResult::Failed);
+			return;
+		}
+	}
+	else if (Result != ESaveCloudResult::NotFound)
+	{
+		Finish(Result);
+		return;
+	}
+
+	if (bUpload)
+	{
+		BeginUpload();
+	}
+	else
+	{
+		BeginDownload();
+	}
+}
+
+void FSaveCloudSyncOp::BeginUpload()
+{
+	if (Local->Files.Num() == 0)
+	{
+		Finish(ESaveCloudResult::NotFound);
+		return;
+	}
+
+	const FSHAHash LocalHash = Local->Manifest.GetContentHash();
+	if (bHasRemote)
+	{
+		const FSHAHash RemoteHash = Remote.GetContentHash();
+		if (RemoteHash == LocalHash)
+		{
+			SaveCloudSync::SaveLastSynced(Slot, LocalHash);
+			Finish(ESaveCloudResult::Success);
+			return;
+		}
+
+		// The remote moved since this device last synced (or it never did): don't overwrite another device's progress.
+		FSHAHash LastHash;
+		if (!bForce && (!SaveCloudSync::LoadLastSynced(Slot, LastHash) || LastHash != RemoteHash))
+		{
+			Finish(ESaveCloudResult::Conflict);
+			return;
+		}
+	}
+
+	TSet<FSHAHash> RemoteChunks;
+	for (const SaveCloudSync::FFileEntry& File : Remote.Files)
+	{
+		for (const SaveCloudSync::FChunkRef& Chunk : File.Chunks)
+		{
+			RemoteChunks.Add(Chunk.Hash);
+		}
+	}
+
+	for (const SaveCloudSync::FFileEntry& File : Local->Manifest.Files)
+	{
+		for (const SaveCloudSync::FChunkRef& Chunk : File.Chunks)
+		{
+			bool bKnown = false;
+			RemoteChunks.Add(Chunk.Hash, &bKnown);
+			if (!bKnown)
+			{
+				TransferQueue.Add(Chunk.Hash);
+				BytesTotal += Chunk.StoredSize;
+			}
+		}
+	}
+
+	UE_LOG(LogSaveSystem, Log, TEXT("[SaveCloudSync] Upload %s: %d chunks (%lld bytes) to send."), *Slot, TransferQueue.Num(), BytesTotal);
+	ReportProgress(0);
+	TransferNext();
+}
+
+void FSaveCloudSyncOp::BeginDownload()
+{
+	if (!bHasRemote)
+	{
+		Finish(ESaveCloudResult::NotFound);
+		return;
+	}
+
+	const FSHAHash RemoteHash = Remote.GetContentHash();
+	const FSHAHash LocalHash = Local->Manifest.GetContentHash();
+	if (Local->Files.Num() > 0 && RemoteHash == LocalHash)
+	{
+		SaveCloudSync::SaveLastSynced(Slot, RemoteHash);
+		Finish(ESaveCloudResult::Success);
+		return;
+	}
+
+	// Local progress made since the last sync would be lost; without a record there is no telling, as for uploads.
+	FSHAHash LastHash;
+	if (!bForce && Local->Files.Num() > 0 && (!SaveCloudSync::LoadLastSynced(Slot, LastHash) || LastHash != LocalHash))
+	{
+		Finish(ESaveCloudResult::Conflict);
+		return;
+	}
+
+	TSet<FSHAHash> Queued;
+	for (const SaveCloudSync::FFileEntry& File : Remote.Files)
+	{
+		for (const SaveCloudSync::FChunkRef& Chunk : File.Chunks)
+		{
+			bool bAlreadyQueued = false;
+			Queued.Add(Chunk.Hash, &bAlreadyQueued);
+			if (!bAlreadyQueued && !Local->Chunks.Contains(Chunk.Hash))
+			{
+				TransferQueue.Add(Chunk.Hash);
+				BytesTotal += Chunk.StoredSize;
+			}
+		}
+	}
+
+	UE_LOG(LogSaveSystem, Log, TEXT("[SaveCloudSync] Download %s: %d chunks (%lld bytes) to fetch."), *Slot, TransferQueue.Num(), BytesTotal);
+	ReportProgress(0);
+	TransferNext();
+}
+
+void FSaveCloudSyncOp::TransferNext()
+{
+	if (!bRunning) return;
+
+	if (TransferIndex >= TransferQueue.Num())
+	{
+		if (bUpload)
+		{
+			UploadManifest();
+		}
+		else
+		{
+			AssembleDownload();
+		}
+		return;
+	}
+
+	const FSHAHash Hash = TransferQueue[TransferIndex++];
+	const TWeakPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> WeakThis = AsShared();
+	auto Progress = [WeakThis](int64 Transferred, int64 /*Total*/)
+	{
+		if (const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin())
+		{
+			Self->ReportProgress(Transferred);
+		}
+	};
+
+	if (bUpload)
+	{
+		// Each chunk is queued once, so its encoded bytes can move into the request.
+		TArray<uint8> Bytes = MoveTemp(Local->Encoded.FindChecked(Hash));
+		const int64 Size = Bytes.Num();
+		Backend->WriteFile(SaveCloudSync::GetChunkName(ChunkPrefix, Hash), MoveTemp(Bytes), PartBytes, Progress, [WeakThis, Size](ESaveCloudResult Result)
+		{
+			const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin();
+			if (!Self || !Self->bRunning) return;
+			if (Result != ESaveCloudResult::Success)
+			{
+				Self->Finish(Result);
+				return;
+			}
+			Self->BytesDone += Size;
+			Self->ReportProgress(0);
+			Self->TransferNext();
+		});
+		return;
+	}
+
+	Backend->ReadFile(SaveCloudSync::GetChunkName(ChunkPrefix, Hash), PartBytes, Progress, [WeakThis, Hash](ESaveCloudResult Result, TArray<uint8>&& Bytes)
+	{
+		const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin();
+		if (!Self || !Self->bRunning) return;
+
+		// A chunk the manifest lists but the store doesn't have means the remote copy is incomplete.
+		TArray<uint8> Raw;
+		if (Result != ESaveCloudResult::Success || !SaveCloudSync::DecodeChunk(Bytes, Raw) || HashBytes(Raw) != Hash)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveCloudSync] %s: chunk %s is missing or damaged."), *Self->Slot, *Hash.ToString());
+			Self->Finish(Result == ESaveCloudResult::Success || Result == ESaveCloudResult::NotFound ? ESaveCloudResult::Failed : Result);
+			return;
+		}
+		Self->BytesDone += Bytes.Num();
+		Self->Downloaded->Add(Hash, MoveTemp(Raw));
+		Self->ReportProgress(0);
+		Self->TransferNext();
+	});
+}
+
+void FSaveCloudSyncOp::UploadManifest()
+{
+	// Chunks first, manifest last: a device reading mid-upload still sees the previous complete set.
+	TArray<uint8> Bytes;
+	Local->Manifest.Write(Bytes);
+
+	const TWeakPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Backend->WriteFile(ManifestName, MoveTemp(Bytes), PartBytes, nullptr, [WeakThis](ESaveCloudResult Result)
+	{
+		const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin();
+		if (!Self || !Self->bRunning) return;
+		if (Result != ESaveCloudResult::Success)
+		{
+			Self->Finish(Result);
+			return;
+		}
+		SaveCloudSync::SaveLastSynced(Self->Slot, Self->Local->Manifest.GetContentHash());
+
+		// Chunks only the replaced manifest referenced.
+		TArray<FSHAHash> Orphans;
+		for (const SaveCloudSync::FFileEntry& File : Self->Remote.Files)
+		{
+			for (const SaveCloudSync::FChunkRef& Chunk : File.Chunks)
+			{
+				if (!Self->Local->Chunks.Contains(Chunk.Hash))
+				{
+					Orphans.AddUnique(Chunk.Hash);
+				}
+			}
+		}
+		Self->DeleteOrphans(MoveTemp(Orphans));
+	});
+}
+
+void FSaveCloudSyncOp::DeleteOrphans(TArray<FSHAHash>&& Orphans)
+{
+	if (!bRunning) return;
+
+	if (Orphans.Num() == 0)
+	{
+		Finish(ESaveCloudResult::Success);
+		return;
+	}
+
+	// Best effort: a chunk left behind only costs storage.
+	const FSHAHash Hash = Orphans.Pop(EAllowShrinking::No);
+	const TWeakPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Backend->DeleteFile(SaveCloudSync::GetChunkName(ChunkPrefix, Hash), [WeakThis, Rest = MoveTemp(Orphans)](ESaveCloudResult) mutable
+	{
+		if (const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin())
+		{
+			Self->DeleteOrphans(MoveTemp(Rest));
+		}
+	});
+}
+
+void FSaveCloudSyncOp::AssembleDownload()
+{
+	const TSharedRef<SaveCloudSync::FLocalState, ESPMode::ThreadSafe> State = Local;
+	const TSharedRef<TMap<FSHAHash, TArray<uint8>>, ESPMode::ThreadSafe> Chunks = Downloaded;
+	const TSharedRef<TArray<SaveCloudSync::FSyncFile>, ESPMode::ThreadSafe> Files = MakeShared<TArray<SaveCloudSync::FSyncFile>, ESPMode::ThreadSafe>();
+	const TWeakPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> WeakThis = AsShared();
+	const SaveCloudSync::FManifest Manifest = Remote;
+	const FString LocalSlot = Slot;
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [State, Chunks, Files, WeakThis, Manifest, LocalSlot]()
+	{
+		bool bOk = true;
+		for (const SaveCloudSync::FFileEntry& Entry : Manifest.Files)
+		{
+			SaveCloudSync::FSyncFile& File = Files->AddDefaulted_GetRef();
+			File.Suffix = Entry.Suffix;
+			File.Bytes.Reserve(static_cast<int32>(Entry.Size));
+
+			for (const SaveCloudSync::FChunkRef& Chunk : Entry.Chunks)
+			{
+				if (const TArray<uint8>* Fetched = Chunks->Find(Chunk.Hash))
+				{
+					File.Bytes.Append(*Fetched);
+				}
+				else if (const SaveCloudSync::FLocalState::FLocation* Loc = State->Chunks.Find(Chunk.Hash))
+				{
+					File.Bytes.Append(State->Files[Loc->File].Bytes.GetData() + Loc->Offset, Loc->Size);
+				}
+			}
+
+			if (File.Bytes.Num() != Entry.Size || HashBytes(File.Bytes) != Entry.Hash)
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveCloudSync] %s%s: reassembled file doesn't match the manifest."), *LocalSlot, *Entry.Suffix);
+				bOk = false;
+				break;
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Files, bOk]()
+		{
+			const TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> Self = WeakThis.Pin();
+			if (!Self || !Self->bRunning) return;
+
+			if (!bOk || !Self->ApplyFiles || !Self->ApplyFiles(MoveTemp(*Files)))
+			{
+				Self->Finish(ESaveCloudResult::Failed);
+				return;
+			}
+			SaveCloudSync::SaveLastSynced(Self->Slot, Self->Remote.GetContentHash());
+			Self->Finish(ESaveCloudResult::Success);
+		});
+	});
+}
+
+void FSaveCloudSyncOp::ReportProgress(int64 CurrentBytes)
+{
+	if (OnProgress)
+	{
+		OnProgress(FMath::Min(BytesDone + CurrentBytes, BytesTotal), BytesTotal);
+	}
+}
+
+void FSaveCloudSyncOp::Finish(ESaveCloudResult Result)
+{
+	if (!bRunning) return;
+	bRunning = false;
+
+	// Downloaded chunks stay until the op goes away; a reassembly worker may still be reading them.
+	Backend->CancelAll();
+	TransferQueue.Reset();
+
+	UE_LOG(LogSaveSystem, Log, TEXT("[SaveCloudSync] %s %s: %s (%lld bytes transferred)."), bUpload ? TEXT("Upload") : TEXT("Download"), *Slot,
+		*StaticEnum<ESaveCloudResult>()->GetNameStringByValue(static_cast<int64>(Result)), BytesDone);
+
+	if (OnFinished)
+	{
+		OnFinished(Result);
+	}
+}
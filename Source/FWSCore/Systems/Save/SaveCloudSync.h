@@ -0,0 +1,163 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+#include "Tasks/Task.h"
+#include "SaveCloudBackend.h"
+
+/**
+ * Delta sync of a profile's slot files with a cloud file store.
+ * Each slot file (the profile slot and its "@<Partition>" chunk slots) is cut into content-defined chunks
+ * with a rolling Gear hash, so an edit only changes the chunks around it. Chunks are stored remotely as
+ * "c_<Slot>_<sha1>" (compressed per chunk) and listed by one manifest per profile, uploaded last. Chunks are
+ * never shared between profiles, so an upload can delete the ones its previous manifest no longer lists.
+ * Uploads send the chunks the remote manifest doesn't list; downloads fetch the chunks no local file has.
+ */
+namespace SaveCloudSync
+{
+	struct FChunkRef
+	{
+		FSHAHash Hash;
+		int32 Size = 0;
+		/** Encoded (compressed) size of the remote object; only used for progress totals. */
+		int32 StoredSize = 0;
+	};
+
+	struct FFileEntry
+	{
+		/** Slot name relative to the profile: "" for the profile slot, "@<Key>" for a chunk slot. */
+		FString Suffix;
+		int64 Size = 0;
+		FSHAHash Hash;
+		TArray<FChunkRef> Chunks;
+	};
+
+	struct FWSCORE_API FManifest
+	{
+		FDateTime Timestamp;
+		TArray<FFileEntry> Files;
+
+		/** Hash over the file list only (not the timestamp): equal for equal content on any device. */
+		FSHAHash GetContentHash() const;
+
+		void Write(TArray<uint8>& OutBytes) const;
+		bool Read(TConstArrayView<uint8> Bytes);
+	};
+
+	/** Content-defined chunk bounds: a cut is never closer than MinChunkSize and forced at MaxChunkSize. */
+	constexpr int32 MinChunkSize = 16 * 1024;
+	constexpr int32 AvgChunkSize = 64 * 1024;
+	constexpr int32 MaxChunkSize = 256 * 1024;
+
+	/** Cut points of Bytes (exclusive end offsets, the last one is Bytes.Num()). Thread-safe. */
+	FWSCORE_API void SplitChunks(TConstArrayView<uint8> Bytes, TArray<int32>& OutEnds);
+
+	/** Remote object of one chunk: [codec][raw size][data], zlib when it shrinks. */
+	FWSCORE_API void EncodeChunk(TConstArrayView<uint8> Raw, TArray<uint8>& OutEncoded);
+	FWSCORE_API bool DecodeChunk(TConstArrayView<uint8> Encoded, TArray<uint8>& OutRaw);
+
+	FWSCORE_API FString GetManifestName(const FString& Slot, int32 MaxLength);
+	/** "c_<Slot>_", or a hash of the slot in place of the name when a chunk name would exceed MaxLength. */
+	FWSCORE_API FString GetChunkPrefix(const FString& Slot, int32 MaxLength);
+	FWSCORE_API FString GetChunkName(const FString& Prefix, const FSHAHash& Hash);
+
+	/** Content hash of the manifest this device last uploaded or applied ("<Slot>.cloudsync"). */
+	FWSCORE_API bool LoadLastSynced(const FString& Slot, FSHAHash& OutHash);
+	FWSCORE_API void SaveLastSynced(const FString& Slot, const FSHAHash& Hash);
+	FWSCORE_API void ClearLastSynced(const FString& Slot);
+
+	/** One slot file: the journal folded in, re-encoded uncompressed so unchanged objects give unchanged bytes. */
+	struct FSyncFile
+	{
+		FString Suffix;
+		TArray<uint8> Bytes;
+	};
+
+	/** Local side of a sync: the profile's files, their manifest and where each chunk lives. */
+	struct FLocalState
+	{
+		TArray<FSyncFile> Files;
+		FManifest Manifest;
+
+		struct FLocation
+		{
+			int32 File = 0;
+			int32 Offset = 0;
+			int32 Size = 0;
+		};
+		TMap<FSHAHash, FLocation> Chunks;
+
+		/** Encoded chunk objects, keyed by raw hash (filled for uploads). */
+		TMap<FSHAHash, TArray<uint8>> Encoded;
+	};
+
+	/** Reads, canonicalizes and chunks every slot file of the profile. Takes the slot lock per file. Thread-safe. */
+	FWSCORE_API void CollectLocal(const FString& Slot, bool bEncodeChunks, FLocalState& Out);
+}
+
+/**
+ * One upload or download of a profile, driven on the game thread by backend callbacks.
+ * Chunking and reassembly run on worker tasks; transfers run one at a time in PartBytes parts.
+ * Conflict policy: a side that moved away from the last synced content is only overwritten with bForce.
+ */
+class FWSCORE_API FSaveCloudSyncOp : public TSharedFromThis<FSaveCloudSyncOp, ESPMode::ThreadSafe>
+{
+public:
+	using FOnProgress = TFunction<void(int64 BytesTransferred, int64 BytesTotal)>;
+	using FOnFinished = TFunction<void(ESaveCloudResult Result)>;
+
+	/** GT: installs downloaded files (slot writes, reload). False aborts with Failed. */
+	using FApplyFiles = TFunction<bool(TArray<SaveCloudSync::FSyncFile>&& Files)>;
+
+	FSaveCloudSyncOp(const TSharedRef<ISaveCloudBackend>& InBackend, const FString& InSlot, bool bInUpload, bool bInForce, int32 InPartBytes);
+
+	/** Local files are read once Prerequisite (the last queued slot write) has finished. */
+	void Start(const UE::Tasks::FTask& Prerequisite);
+
+	/** Stops at the next step; OnFinished fires with Cancelled. */
+	void Cancel();
+
+	bool IsUpload() const { return bUpload; }
+	bool IsRunning() const { return bRunning; }
+	const FString& GetSlot() const { return Slot; }
+
+	FOnProgress OnProgress;
+	FOnFinished OnFinished;
+	FApplyFiles ApplyFiles;
+
+private:
+	void OnLocalCollected();
+	void OnRemoteManifest(ESaveCloudResult Result, TArray<uint8>&& Bytes);
+
+	void BeginUpload();
+	void BeginDownload();
+	void AssembleDownload();
+
+	/** Moves the chunks in TransferQueue one after another, then uploads the manifest / assembles the download. */
+	void TransferNext();
+	void UploadManifest();
+	void DeleteOrphans(TArray<FSHAHash>&& Orphans);
+
+	void Finish(ESaveCloudResult Result);
+	void ReportProgress(int64 CurrentBytes);
+
+	TSharedRef<ISaveCloudBackend> Backend;
+	FString Slot;
+	FString ManifestName;
+	FString ChunkPrefix;
+	bool bUpload = false;
+	bool bForce = false;
+	bool bRunning = false;
+	int32 PartBytes = 0;
+
+	TSharedRef<SaveCloudSync::FLocalState, ESPMode::ThreadSafe> Local;
+	SaveCloudSync::FManifest Remote;
+	bool bHasRemote = false;
+
+	TArray<FSHAHash> TransferQueue;
+	int32 TransferIndex = 0;
+	TSharedRef<TMap<FSHAHash, TArray<uint8>>, ESPMode::ThreadSafe> Downloaded;
+
+	int64 BytesTotal = 0;
+	int64 BytesDone = 0;
+};
@@ -0,0 +1,577 @@
+﻿#include "SaveFieldStore.h"
+#include "Misc/Base64.h"
+#include "Misc/DefaultValueHelper.h"
+
+/* ---------- Internals ---------- */
+
+int32 FSaveFieldStore::IndexOf(FName Key) const
+{
+	// Objects hold a handful of fields; a linear FName compare beats hashing here.
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		if (Keys[i] == Key) return i;
+	}
+	return INDEX_NONE;
+}
+
+int32 FSaveFieldStore::AllocateSlot(ESaveFieldType Type)
+{
+	switch (Type)
+	{
+	case ESaveFieldType::Int:    return Ints.AddDefaulted();
+	case ESaveFieldType::Float:  return Floats.AddDefaulted();
+	case ESaveFieldType::Name:   return Names.AddDefaulted();
+	case ESaveFieldType::String: return Strings.AddDefaulted();
+	case ESaveFieldType::Blob:   return Blobs.AddDefaulted();
+	default:                     return 0; // Bool keeps its value in the slot itself
+	}
+}
+
+void FSaveFieldStore::ReleaseSlot(int32 FieldIndex)
+{
+	const ESaveFieldType Type = Types[FieldIndex];
+	const int32 Slot = Slots[FieldIndex];
+
+	int32 LastSlot = INDEX_NONE;
+	switch (Type)
+	{
+	case ESaveFieldType::Int:    LastSlot = Ints.Num() - 1;    Ints.RemoveAtSwap(Slot, 1, EAllowShrinking::No);    break;
+	case ESaveFieldType::Float:  LastSlot = Floats.Num() - 1;  Floats.RemoveAtSwap(Slot, 1, EAllowShrinking::No);  break;
+	case ESaveFieldType::Name:   LastSlot = Names.Num() - 1;   Names.RemoveAtSwap(Slot, 1, EAllowShrinking::No);   break;
+	case ESaveFieldType::String: LastSlot = Strings.Num() - 1; Strings.RemoveAtSwap(Slot, 1, EAllowShrinking::No); break;
+	case ESaveFieldType::Blob:   LastSlot = Blobs.Num() - 1;   Blobs.RemoveAtSwap(Slot, 1, EAllowShrinking::No);   break;
+	default: return;
+	}
+
+	// The former last entry now lives at Slot; repoint whichever field owned it.
+	if (LastSlot != Slot)
+	{
+		for (int32 i = 0; i < Types.Num(); ++i)
+		{
+			if (Types[i] == Type && Slots[i] == LastSlot)
+			{
+				Slots[i] = Slot;
+				break;
+			}
+		}
+	}
+}
+
+int32 FSaveFieldStore::AcquireField(FName Key, ESaveFieldType Type, bool& bOutFresh)
+{
+	int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE)
+	{
+		Index = Keys.Add(Key);
+		Types.Add(Type);
+		Slots.Add(AllocateSlot(Type));
+		bOutFresh = true;
+		return Index;
+	}
+
+	bOutFresh = Types[Index] != Type;
+	if (bOutFresh)
+	{
+		ReleaseSlot(Index);
+		Types[Index] = Type;
+		Slots[Index] = AllocateSlot(Type);
+	}
+	return Index;
+}
+
+/* ---------- Write ---------- */
+
+namespace
+{
+	template <typename T>
+	bool AssignIfChanged(T& Dest, const T& Value, bool bFresh)
+	{
+		if (!bFresh && Dest == Value) return false;
+		Dest = Value;
+		return true;
+	}
+}
+
+bool FSaveFieldStore::SetInt(FName Key, int64 Value)
+{
+	bool bFresh = false;
+	const int32 Index = AcquireField(Key, ESaveFieldType::Int, bFresh);
+	return AssignIfChanged(Ints[Slots[Index]], Value, bFresh);
+}
+
+bool FSaveFieldStore::SetFloat(FName Key, float Value)
+{
+	bool bFresh = false;
+	const int32 Index = AcquireField(Key, ESaveFieldType::Float, bFresh);
+	return AssignIfChanged(Floats[Slots[Index]], Value, bFresh);
+}
+
+bool FSaveFieldStore::SetBool(FName Key, bool bValue)
+{
+	bool bFresh = false;
+	const int32 Index = AcquireField(Key, ESaveFieldType::Bool, bFresh);
+	return AssignIfChanged(Slots[Index], bValue ? 1 : 0, bFresh);
+}
+
+bool FSaveFieldStore::SetName(FName Key, FName Value)
+{
+	bool bFresh = false;
+	const int32 Index = AcquireField(Key, ESaveFieldType::Name, bFresh);
+	FName& Dest = Names[Slots[Index]];
+	// FName == ignores case; compare exactly so a casing change still persists.
+	if (!bFresh && Dest.IsEqual(Value, ENameCase::CaseSensitive)) return false;
+	Dest = Value;
+	return true;
+}
+
+bool FSaveFieldStore::SetString(FName Key, const FString& Value)
+{
+	bool bFresh = false;
+	const int32 Index = AcquireField(Key, ESaveFieldType::String, bFresh);
+	FString& Dest = Strings[Slots[Index]];
+	if (!bFresh && Dest.Equals(Value, ESearchCase::CaseSensitive)) return false;
+	Dest = Value;
+	return true;
+}
+
+bool FSaveFieldStore::SetBlob(FName Key, TArray<uint8> Value)
+{
+	bool bFresh = false;
+	const int32 Index = AcquireField(Key, ESaveFieldType::Blob, bFresh);
+	TArray<uint8>& Dest = Blobs[Slots[Index]].Bytes;
+	if (!bFresh && Dest == Value) return false;
+	Dest = MoveTemp(Value);
+	return true;
+}
+
+bool FSaveFieldStore::SetFromLegacyText(FName Key, const FString& Value)
+{
+	// Only exact round trips are retyped, so GetAsString (and BP GetField) still sees the original text;
+	// typed reads of the value then never parse it again.
+	int64 IntValue = 0;
+	if (FDefaultValueHelper::ParseInt64(Value, IntValue) && LexToString(IntValue) == Value)
+	{
+		return SetInt(Key, IntValue);
+	}
+	float FloatValue = 0.f;
+	if (FDefaultValueHelper::ParseFloat(Value, FloatValue) && FString::SanitizeFloat(FloatValue) == Value)
+	{
+		return SetFloat(Key, FloatValue);
+	}
+	return SetString(Key, Value);
+}
+
+bool FSaveFieldStore::Remove(FName Key)
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE) return false;
+
+	ReleaseSlot(Index);
+	Keys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Types.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Slots.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	return true;
+}
+
+void FSaveFieldStore::Reset()
+{
+	Keys.Reset();
+	Types.Reset();
+	Slots.Reset();
+	Ints.Reset();
+	Floats.Reset();
+	Names.Reset();
+	Strings.Reset();
+	Blobs.Reset();
+}
+
+/* ---------- Read ---------- */
+
+ESaveFieldType FSaveFieldStore::GetType(FName Key) const
+{
+	const int32 Index = IndexOf(Key);
+	return Index != INDEX_NONE ? Types[Index] : ESaveFieldType::None;
+}
+
+bool FSaveFieldStore::GetInt(FName Key, int64& Out) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE) return false;
+
+	const int32 Slot = Slots[Index];
+	switch (Types[Index])
+	{
+	case ESaveFieldType::Int:    Out = Ints[Slot]; return true;
+	case ESaveFieldType::Float:  Out = FMath::TruncToInt64(Floats[Slot]); return true;
+	case ESaveFieldType::Bool:   Out = Slot; return true;
+	case ESaveFieldType::String: return FDefaultValueHelper::ParseInt64(Strings[Slot], Out); // legacy slot
+	default:                     return false;
+	}
+}
+
+bool FSaveFieldStore::GetFloat(FName Key, float& Out) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE) return false;
+
+	const int32 Slot = Slots[Index];
+	switch (Types[Index])
+	{
+	case ESaveFieldType::Float:  Out = Floats[Slot]; return true;
+	case ESaveFieldType::Int:    Out = static_cast<float>(Ints[Slot]); return true;
+	case ESaveFieldType::Bool:   Out = static_cast<float>(Slot); return true;
+	case ESaveFieldType::String: return FDefaultValueHelper::ParseFloat(Strings[Slot], Out); // legacy slot
+	default:                     return false;
+	}
+}
+
+bool FSaveFieldStore::GetBool(FName Key, bool& Out) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE) return false;
+
+	const int32 Slot = Slots[Index];
+	switch (Types[Index])
+	{
+	case ESaveFieldType::Bool:  Out = Slot != 0; return true;
+	case ESaveFieldType::Int:   Out = Ints[Slot] != 0; return true;
+	case ESaveFieldType::Float: Out = Floats[Slot] != 0.f; return true;
+	case ESaveFieldType::String:
+		{
+			const FString& S = Strings[Slot]; // legacy slot
+			Out = (S == TEXT("1") || S.Equals(TEXT("true"), ESearchCase::IgnoreCase));
+			return true;
+		}
+	default: return false;
+	}
+}
+
+bool FSaveFieldStore::GetName(FName Key, FName& Out) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE) return false;
+
+	const int32 Slot = Slots[Index];
+	switch (Types[Index])
+	{
+	case ESaveFieldType::Name:   Out = Names[Slot]; return true;
+	case ESaveFieldType::String: Out = FName(*Strings[Slot]); return true; // legacy slot
+	case ESaveFieldType::Int:    Out = FName(*LexToString(Ints[Slot])); return true; // legacy text retyped on upgrade
+	case ESaveFieldType::Float:  Out = FName(*FString::SanitizeFloat(Floats[Slot])); return true;
+	default:                     return false;
+	}
+}
+
+bool FSaveFieldStore::GetString(FName Key, FString& Out) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE || Types[Index] != ESaveFieldType::String) return false;
+
+	Out = Strings[Slots[Index]];
+	return true;
+}
+
+const TArray<uint8>* FSaveFieldStore::GetBlob(FName Key) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE || Types[Index] != ESaveFieldType::Blob) return nullptr;
+
+	return &Blobs[Slots[Index]].Bytes;
+}
+
+bool FSaveFieldStore::GetAsString(FName Key, FString& Out) const
+{
+	const int32 Index = IndexOf(Key);
+	if (Index == INDEX_NONE) return false;
+
+	const int32 Slot = Slots[Index];
+	switch (Types[Index])
+	{
+	case ESaveFieldType::Int:    Out = LexToString(Ints[Slot]); return true;
+	case ESaveFieldType::Float:  Out = FString::SanitizeFloat(Floats[Slot]); return true;
+	case ESaveFieldType::Bool:   Out = Slot ? TEXT("1") : TEXT("0"); return true;
+	case ESaveFieldType::Name:   Out = Names[Slot].ToString(); return true;
+	case ESaveFieldType::String: Out = Strings[Slot]; return true;
+	case ESaveFieldType::Blob:   Out = FBase64::Encode(Blobs[Slot].Bytes); return true;
+	default:                     return false;
+	}
+}
+
+bool FSaveFieldStore::operator==(const FSaveFieldStore& Other) const
+{
+	if (Keys.Num() != Other.Keys.Num()) return false;
+
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		const int32 j = Other.IndexOf(Keys[i]);
+		if (j == INDEX_NONE || Types[i] != Other.Types[j]) return false;
+
+		const int32 A = Slots[i];
+		const int32 B = Other.Slots[j];
+		switch (Types[i])
+		{
+		case ESaveFieldType::Int:    if (Ints[A] != Other.Ints[B]) return false; break;
+		case ESaveFieldType::Float:  if (Floats[A] != Other.Floats[B]) return false; break;
+		case ESaveFieldType::Bool:   if (A != B) return false; break;
+		case ESaveFieldType::Name:   if (Names[A] != Other.Names[B]) return false; break;
+		case ESaveFieldType::String: if (!Strings[A].Equals(Other.Strings[B], ESearchCase::CaseSensitive)) return false; break;
+		case ESaveFieldType::Blob:   if (Blobs[A].Bytes != Other.Blobs[B].Bytes) return false; break;
+		default: break;
+		}
+	}
+	return true;
+}
+
+/* ---------- Serialization ---------- */
+
+FArchive& operator<<(FArchive& Ar, FSaveFieldStore& Store)
+{
+	Ar << Store.Keys;
+
+	// Types are one byte each; bulk-copy rather than going element by element.
+	int32 NumTypes = Store.Types.Num();
+	Ar << NumTypes;
+	if (Ar.IsLoading())
+	{
+		if (NumTypes < 0 || NumTypes != Store.Keys.Num())
+		{
+			Ar.SetError();
+			return Ar;
+		}
+		Store.Types.SetNumUninitialized(NumTypes);
+	}
+	Ar.Serialize(Store.Types.GetData(), NumTypes * sizeof(ESaveFieldType));
+
+	Ar << Store.Slots;
+	Ar << Store.Ints;
+	Ar << Store.Floats;
+	Ar << Store.Names;
+	Ar << Store.Strings;
+
+	int32 NumBlobs = Store.Blobs.Num();
+	Ar << NumBlobs;
+	if (Ar.IsLoading())
+	{
+		if (NumBlobs < 0)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+		Store.Blobs.SetNum(NumBlobs);
+	}
+	for (FSaveFieldBlob& Blob : Store.Blobs)
+	{
+		Ar << Blob.Bytes;
+	}
+
+	if (Ar.IsLoading() && !Ar.IsError())
+	{
+		// The accessors index the columns through Slots unchecked, so a damaged image must fail here.
+		bool bValid = Store.Slots.Num() == Store.Keys.Num();
+		for (int32 i = 0; bValid && i < Store.Slots.Num(); ++i)
+		{
+			const int32 Slot = Store.Slots[i];
+			switch (Store.Types[i])
+			{
+			case ESaveFieldType::None:   bValid = Slot == 0; break;
+			case ESaveFieldType::Int:    bValid = Store.Ints.IsValidIndex(Slot); break;
+			case ESaveFieldType::Float:  bValid = Store.Floats.IsValidIndex(Slot); break;
+			case ESaveFieldType::Bool:   bValid = Slot == 0 || Slot == 1; break;
+			case ESaveFieldType::Name:   bValid = Store.Names.IsValidIndex(Slot); break;
+			case ESaveFieldType::String: bValid = Store.Strings.IsValidIndex(Slot); break;
+			case ESaveFieldType::Blob:   bValid = Store.Blobs.IsValidIndex(Slot); break;
+			default:                     bValid = false; break;
+			}
+		}
+		if (!bValid)
+		{
+			Store.Reset();
+			Ar.SetError();
+		}
+	}
+	return Ar;
+}
+
+/* ---------- Compact encoding ---------- */
+
+uint32 FSaveNameDictionary::Add(FName Name)
+{
+	if (const uint32* Existing = Indices.Find(Name))
+	{
+		return *Existing;
+	}
+	const uint32 Index = Names.Add(Name);
+	Indices.Add(Name, Index);
+	return Index;
+}
+
+void FSaveNameDictionary::Append(TConstArrayView<FName> Existing)
+{
+	Names.Reserve(Names.Num() + Existing.Num());
+	Indices.Reserve(Indices.Num() + Existing.Num());
+	for (const FName& Name : Existing)
+	{
+		// Appended unconditionally so every index of Existing maps to the same name here.
+		const uint32 Index = Names.Add(Name);
+		Indices.FindOrAdd(Name, Index);
+	}
+}
+
+namespace
+{
+	/** Top bit of the type byte carries a Bool field's value. */
+	constexpr uint8 BoolValueBit = 0x80;
+
+	uint64 ZigZag(int64 Value)
+	{
+		return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+	}
+
+	int64 UnZigZag(uint64 Value)
+	{
+		return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+	}
+
+	/** A length/count read from a damaged image can't exceed what is left of the archive. */
+	bool FitsRemaining(const FArchive& Ar, uint64 Count)
+	{
+		return !Ar.IsError() && Count <= static_cast<uint64>(FMath::Max<int64>(Ar.TotalSize() - Ar.Tell(), 0));
+	}
+
+	bool ReadNameIndex(FArchive& Ar, TConstArrayView<FName> Dictionary, FName& Out)
+	{
+		uint32 Index = 0;
+		Ar.SerializeIntPacked(Index);
+		if (Ar.IsError() || Index >= static_cast<uint32>(Dictionary.Num())) return false;
+		Out = Dictionary[Index];
+		return true;
+	}
+}
+
+void FSaveFieldStore::WriteCompact(FArchive& Ar, FSaveNameDictionary& Dictionary) const
+{
+	uint32 NumFields = Keys.Num();
+	Ar.SerializeIntPacked(NumFields);
+
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		uint32 KeyIndex = Dictionary.Add(Keys[i]);
+		Ar.SerializeIntPacked(KeyIndex);
+
+		const int32 Slot = Slots[i];
+		uint8 TypeByte = static_cast<uint8>(Types[i]);
+		if (Types[i] == ESaveFieldType::Bool && Slot != 0)
+		{
+			TypeByte |= BoolValueBit;
+		}
+		Ar << TypeByte;
+
+		switch (Types[i])
+		{
+		case ESaveFieldType::Int:
+		{
+			uint64 Packed = ZigZag(Ints[Slot]);
+			Ar.SerializeIntPacked64(Packed);
+			break;
+		}
+		case ESaveFieldType::Float:
+		{
+			float Value = Floats[Slot];
+			Ar << Value;
+			break;
+		}
+		case ESaveFieldType::Name:
+		{
+			uint32 NameIndex = Dictionary.Add(Names[Slot]);
+			Ar.SerializeIntPacked(NameIndex);
+			break;
+		}
+		case ESaveFieldType::String:
+			Ar << const_cast<FString&>(Strings[Slot]);
+			break;
+		case ESaveFieldType::Blob:
+		{
+			const TArray<uint8>& Bytes = Blobs[Slot].Bytes;
+			uint32 Length = Bytes.Num();
+			Ar.SerializeIntPacked(Length);
+			Ar.Serialize(const_cast<uint8*>(Bytes.GetData()), Length);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+bool FSaveFieldStore::ReadCompact(FArchive& Ar, TConstArrayView<FName> Dictionary)
+{
+	Reset();
+
+	uint32 NumFields = 0;
+	Ar.SerializeIntPacked(NumFields);
+	if (!FitsRemaining(Ar, NumFields)) return false;
+
+	Keys.Reserve(NumFields);
+	Types.Reserve(NumFields);
+	Slots.Reserve(NumFields);
+
+	for (uint32 i = 0; i < NumFields; ++i)
+	{
+		FName Key;
+		uint8 TypeByte = 0;
+		if (!ReadNameIndex(Ar, Dictionary, Key)) return false;
+		Ar << TypeByte;
+
+		const ESaveFieldType Type = static_cast<ESaveFieldType>(TypeByte & ~BoolValueBit);
+		int32 Slot = 0;
+		switch (Type)
+		{
+		case ESaveFieldType::Int:
+		{
+			uint64 Packed = 0;
+			Ar.SerializeIntPacked64(Packed);
+			Slot = Ints.Add(UnZigZag(Packed));
+			break;
+		}
+		case ESaveFieldType::Float:
+			Slot = Floats.AddDefaulted();
+			Ar << Floats[Slot];
+			break;
+		case ESaveFieldType::Bool:
+			Slot = (TypeByte & BoolValueBit) ? 1 : 0;
+			break;
+		case ESaveFieldType::Name:
+		{
+			FName Value;
+			if (!ReadNameIndex(Ar, Dictionary, Value)) return false;
+			Slot = Names.Add(Value);
+			break;
+		}
+		case ESaveFieldType::String:
+			Slot = Strings.AddDefaulted();
+			Ar << Strings[Slot];
+			break;
+		case ESaveFieldType::Blob:
+		{
+			uint32 Length = 0;
+			Ar.SerializeIntPacked(Length);
+			if (!FitsRemaining(Ar, Length)) return false;
+			Slot = Blobs.AddDefaulted();
+			Blobs[Slot].Bytes.SetNumUninitialized(Length);
+			Ar.Serialize(Blobs[Slot].Bytes.GetData(), Length);
+			break;
+		}
+		case ESaveFieldType::None:
+			break;
+		default:
+			// A type this build doesn't know: the rest of the row can't be parsed.
+			return false;
+		}
+
+		Keys.Add(Key);
+		Types.Add(Type);
+		Slots.Add(Slot);
+		if (Ar.IsError()) return false;
+	}
+	return true;
+}
@@ -0,0 +1,145 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveFieldStore.generated.h"
+
+/** Storage type of a single saved field. */
+UENUM(BlueprintType)
+enum class ESaveFieldType : uint8
+{
+	None,
+	Int,
+	Float,
+	Bool,
+	Name,
+	String,
+	Blob
+};
+
+/** One opaque byte blob (UHT can't reflect nested arrays directly). */
+USTRUCT()
+struct FSaveFieldBlob
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<uint8> Bytes;
+};
+
+/**
+ * Per-slot name table of the compact slot encoding.
+ * Each distinct FName (field keys, Name values, object ids) is stored once per image and referenced by varint index.
+ */
+struct FWSCORE_API FSaveNameDictionary
+{
+	/** Index of Name, appending it on first use. */
+	uint32 Add(FName Name);
+
+	/** Seeds the table with another image's names so bytes encoded against it stay valid. */
+	void Append(TConstArrayView<FName> Existing);
+
+	const TArray<FName>& GetNames() const { return Names; }
+	int32 Num() const { return Names.Num(); }
+
+private:
+	TArray<FName> Names;
+	TMap<FName, uint32> Indices;
+};
+
+/**
+ * Typed per-object field store.
+ * Keys/Types/Slots are parallel arrays; Slots index into the column matching the type
+ * (bools keep their value directly in the slot). Typed access never formats or parses text;
+ * only String fields written by older slots go through the legacy parse path.
+ */
+USTRUCT()
+struct FWSCORE_API FSaveFieldStore
+{
+	GENERATED_BODY()
+
+	/* ---------- Write (each returns true if the stored value actually changed) ---------- */
+
+	bool SetInt(FName Key, int64 Value);
+	bool SetFloat(FName Key, float Value);
+	bool SetBool(FName Key, bool bValue);
+	bool SetName(FName Key, FName Value);
+	bool SetString(FName Key, const FString& Value);
+	bool SetBlob(FName Key, TArray<uint8> Value);
+
+	/** Text from a legacy slot: stored as Int/Float when it reads back as the same text, else as String. */
+	bool SetFromLegacyText(FName Key, const FString& Value);
+
+	/** Removes a field; returns false if it didn't exist. */
+	bool Remove(FName Key);
+	void Reset();
+
+	/* ---------- Read ---------- */
+
+	/** Numeric types convert between each other; String fields are parsed (legacy slots). */
+	bool GetInt(FName Key, int64& Out) const;
+	bool GetFloat(FName Key, float& Out) const;
+	bool GetBool(FName Key, bool& Out) const;
+	bool GetName(FName Key, FName& Out) const;
+	bool GetString(FName Key, FString& Out) const;
+	const TArray<uint8>* GetBlob(FName Key) const;
+
+	/** Formats any field type as text (BP / string-facing API). */
+	bool GetAsString(FName Key, FString& Out) const;
+
+	bool Contains(FName Key) const { return IndexOf(Key) != INDEX_NONE; }
+	ESaveFieldType GetType(FName Key) const;
+
+	/* ---------- Iteration ---------- */
+
+	int32 Num() const { return Keys.Num(); }
+	bool IsEmpty() const { return Keys.Num() == 0; }
+	FName GetKeyAt(int32 Index) const { return Keys[Index]; }
+	ESaveFieldType GetTypeAt(int32 Index) const { return Types[Index]; }
+
+	bool operator==(const FSaveFieldStore& Other) const;
+	bool operator!=(const FSaveFieldStore& Other) const { return !(*this == Other); }
+
+	/** Binary form used by the journal (columns are written as-is, names as strings). */
+	friend FWSCORE_API FArchive& operator<<(FArchive& Ar, FSaveFieldStore& Store);
+
+	/** Row form used by slot images: names as dictionary indices, ints as zig-zag varints, bools inside the type byte. */
+	void WriteCompact(FArchive& Ar, FSaveNameDictionary& Dictionary) const;
+
+	/** Replaces the contents with a WriteCompact encoding. False on truncated data or out-of-range indices. */
+	bool ReadCompact(FArchive& Ar, TConstArrayView<FName> Dictionary);
+
+private:
+	int32 IndexOf(FName Key) const;
+
+	/** Returns the field index for Key with its slot bound to a column of Type (allocating if needed). bOutFresh = new or retyped. */
+	int32 AcquireField(FName Key, ESaveFieldType Type, bool& bOutFresh);
+
+	/** Swap-removes the column entry a field points at and patches the field that was moved. */
+	void ReleaseSlot(int32 FieldIndex);
+
+	int32 AllocateSlot(ESaveFieldType Type);
+
+	UPROPERTY()
+	TArray<FName> Keys;
+
+	UPROPERTY()
+	TArray<ESaveFieldType> Types;
+
+	UPROPERTY()
+	TArray<int32> Slots;
+
+	UPROPERTY()
+	TArray<int64> Ints;
+
+	UPROPERTY()
+	TArray<float> Floats;
+
+	UPROPERTY()
+	TArray<FName> Names;
+
+	UPROPERTY()
+	TArray<FString> Strings;
+
+	UPROPERTY()
+	TArray<FSaveFieldBlob> Blobs;
+};
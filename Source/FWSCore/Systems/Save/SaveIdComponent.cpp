@@ -1,4 +1,9 @@
 ﻿#include "SaveIdComponent.h"
+#include "SaveIdRegistry.h"
+#include "SaveSystemSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
 
 USaveIdComponent::USaveIdComponent()
 {
@@ -14,6 +19,51 @@ void USaveIdComponent::OnRegister()
 		SaveGuid = FGuid::NewGuid();
 		// No disk write here; persistence happens via SaveSystem
 	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (USaveIdRegistry* Registry = World->GetSubsystem<USaveIdRegistry>())
+		{
+			Registry->Register(*this);
+		}
+	}
+}
+
+void USaveIdComponent::OnUnregister()
+{
+	// The registry may already be gone when the world is torn down.
+	if (UWorld* World = GetWorld())
+	{
+		if (USaveIdRegistry* Registry = World->GetSubsystem<USaveIdRegistry>())
+		{
+			Registry->Unregister(*this);
+		}
+	}
+	Super::OnUnregister();
+}
+
+void USaveIdComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Only explicit destruction; streaming out, travel and PIE shutdown end play with other reasons.
+	if (EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		const UWorld* World = GetWorld();
+		if (UGameInstance* GI = World ? World->GetGameInstance() : nullptr)
+		{
+			if (USaveSystemSubsystem* SaveSubsystem = GI->GetSubsystem<USaveSystemSubsystem>())
+			{
+				SaveSubsystem->HandleSaveIdDestroyed(*this);
+			}
+		}
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+bool USaveIdComponent::IsPlacedInLevel() const
+{
+	// Level actors are loaded with their package (and duplicated with the flag for PIE); net startup covers the rest.
+	const AActor* Owner = GetOwner();
+	return Owner && (Owner->HasAnyFlags(RF_WasLoaded) || Owner->IsNetStartupActor());
 }
 
 FGuid USaveIdComponent::GetOrCreateGuid()
@@ -24,3 +74,18 @@ FGuid USaveIdComponent::GetOrCreateGuid()
 	}
 	return SaveGuid;
 }
+
+void USaveIdComponent::SetSaveGuid(const FGuid& NewGuid)
+{
+	if (NewGuid == SaveGuid) return;
+
+	const FGuid OldGuid = SaveGuid;
+	SaveGuid = NewGuid;
+	if (IsRegistered())
+	{
+		if (USaveIdRegistry* Registry = USaveIdRegistry::Get(this))
+		{
+			Registry->Rekey(*this, OldGuid);
+		}
+	}
+}
@@ -7,6 +7,9 @@
 /**
  * Attach to any actor that needs stable save identity.
  * Generates and persists a GUID once; can be queried at runtime.
+ * While registered it is indexed by the world's USaveIdRegistry (GUID <-> actor).
+ * The primary profile also keeps the world state around it: runtime-spawned actors that opt in are respawned
+ * by loads, and placed actors destroyed during play stay destroyed.
  */
 UCLASS(ClassGroup=(Save), Blueprintable, meta=(BlueprintSpawnableComponent))
 class FWSCORE_API USaveIdComponent : public UActorComponent
@@ -28,6 +31,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Save")
 	FGuid GetOrCreateGuid();
 
+	/** Assigns a GUID (e.g. restoring a runtime-spawned actor); use instead of writing SaveGuid so the registry follows. */
+	UFUNCTION(BlueprintCallable, Category="Save")
+	void SetSaveGuid(const FGuid& NewGuid);
+
+	/** Runtime-spawned actors: saves record the class and transform, and loads spawn the actor again if it is missing. Read when the component registers. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Save")
+	bool bRespawnOnLoad = false;
+
+	/** Placed actors: being destroyed during play is saved, and loads destroy the actor again. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Save")
+	bool bPersistDestruction = true;
+
+	/** True if the owner came with its level (placed in the editor) rather than being spawned at runtime. */
+	bool IsPlacedInLevel() const;
+
 protected:
 	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
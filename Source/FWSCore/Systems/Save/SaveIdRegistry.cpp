@@ -0,0 +1,109 @@
+﻿#include "SaveIdRegistry.h"
+#include "FWSCore.h"
+#include "SaveIdComponent.h"
+#include "SaveSystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+USaveIdRegistry* USaveIdRegistry::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<USaveIdRegistry>() : nullptr;
+}
+
+AActor* USaveIdRegistry::FindActor(const FGuid& Guid) const
+{
+	const USaveIdComponent* Component = FindComponent(Guid);
+	return Component ? Component->GetOwner() : nullptr;
+}
+
+USaveIdComponent* USaveIdRegistry::FindComponent(const AActor* Actor) const
+{
+	const TWeakObjectPtr<USaveIdComponent>* Found = Actor ? ByActor.Find(Actor) : nullptr;
+	return Found ? Found->Get() : nullptr;
+}
+
+USaveIdComponent* USaveIdRegistry::FindComponent(const FGuid& Guid) const
+{
+	const TWeakObjectPtr<USaveIdComponent>* Found = ByGuid.Find(Guid);
+	return Found ? Found->Get() : nullptr;
+}
+
+FGuid USaveIdRegistry::FindGuid(const AActor* Actor) const
+{
+	const USaveIdComponent* Component = FindComponent(Actor);
+	return Component ? Component->SaveGuid : FGuid();
+}
+
+void USaveIdRegistry::FindMissingGuids(const USaveSystem* SaveSystem, TArray<FGuid>& OutMissing) const
+{
+	OutMissing.Reset();
+	if (!SaveSystem) return;
+
+	TArray<FGuid> Saved;
+	SaveSystem->GetSavedGuids(Saved);
+	for (const FGuid& Guid : Saved)
+	{
+		if (!FindComponent(Guid))
+		{
+			OutMissing.Add(Guid);
+		}
+	}
+}
+
+void USaveIdRegistry::Register(USaveIdComponent& Component)
+{
+	AActor* Owner = Component.GetOwner();
+	if (!Owner || !Component.SaveGuid.IsValid()) return;
+
+	TWeakObjectPtr<USaveIdComponent>& Slot = ByGuid.FindOrAdd(Component.SaveGuid);
+	if (USaveIdComponent* Existing = Slot.Get(); Existing && Existing != &Component)
+	{
+		// Typically an actor duplicated in the editor along with its GUID; the first one keeps the save data.
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveIdRegistry] %s has the same SaveGuid as %s; only the first one loads its data."),
+			*Owner->GetName(), Existing->GetOwner() ? *Existing->GetOwner()->GetName() : TEXT("?"));
+	}
+	else
+	{
+		Slot = &Component;
+	}
+	ByActor.Add(Owner, &Component);
+	if (Component.bRespawnOnLoad)
+	{
+		Respawnable.Add(&Component);
+	}
+}
+
+void USaveIdRegistry::Unregister(USaveIdComponent& Component)
+{
+	Respawnable.Remove(&Component);
+	if (const TWeakObjectPtr<USaveIdComponent>* Found = ByGuid.Find(Component.SaveGuid); Found && (!Found->IsValid() || Found->Get() == &Component))
+	{
+		ByGuid.Remove(Component.SaveGuid);
+	}
+	if (AActor* Owner = Component.GetOwner())
+	{
+		if (const TWeakObjectPtr<USaveIdComponent>* Found = ByActor.Find(Owner); Found && (!Found->IsValid() || Found->Get() == &Component))
+		{
+			ByActor.Remove(Owner);
+		}
+	}
+}
+
+void USaveIdRegistry::Rekey(USaveIdComponent& Component, const FGuid& OldGuid)
+{
+	if (const TWeakObjectPtr<USaveIdComponent>* Found = ByGuid.Find(OldGuid); Found && Found->Get() == &Component)
+	{
+		ByGuid.Remove(OldGuid);
+	}
+	Register(Component);
+}
+
+void USaveIdRegistry::Deinitialize()
+{
+	ByGuid.Reset();
+	ByActor.Reset();
+	Respawnable.Reset();
+	Super::Deinitialize();
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SaveIdRegistry.generated.h"
+
+class USaveIdComponent;
+class USaveSystem;
+
+/**
+ * GUID <-> actor index of the world's registered USaveIdComponents, kept up to date by the components'
+ * OnRegister/OnUnregister. Both directions are hash lookups, so the save pipeline never searches an actor's
+ * components, and saved GUIDs without an actor (destroyed, not streamed in or not spawned yet) are found
+ * by walking the save's GUIDs instead of the live actors. Game thread only.
+ */
+UCLASS()
+class FWSCORE_API USaveIdRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USaveIdRegistry* Get(const UObject* WorldContextObject);
+
+	UFUNCTION(BlueprintPure, Category="Save")
+	AActor* FindActor(const FGuid& Guid) const;
+
+	/** Registered component of the actor; null if it has none. */
+	USaveIdComponent* FindComponent(const AActor* Actor) const;
+	USaveIdComponent* FindComponent(const FGuid& Guid) const;
+
+	/** Invalid if the actor has no registered component. */
+	UFUNCTION(BlueprintPure, Category="Save")
+	FGuid FindGuid(const AActor* Actor) const;
+
+	bool Contains(const FGuid& Guid) const { return ByGuid.Contains(Guid); }
+	int32 Num() const { return ByGuid.Num(); }
+
+	/** Every registered component by GUID (the first one, for duplicated GUIDs). */
+	const TMap<FGuid, TWeakObjectPtr<USaveIdComponent>>& GetComponents() const { return ByGuid; }
+
+	/** Registered components with bRespawnOnLoad (placed actors included; see USaveIdComponent::IsPlacedInLevel). */
+	const TSet<TWeakObjectPtr<USaveIdComponent>>& GetRespawnable() const { return Respawnable; }
+
+	/** GUID payloads of SaveSystem that no registered actor claims. Never decodes a payload. */
+	UFUNCTION(BlueprintCallable, Category="Save")
+	void FindMissingGuids(const USaveSystem* SaveSystem, TArray<FGuid>& OutMissing) const;
+
+	/** Called by USaveIdComponent. */
+	void Register(USaveIdComponent& Component);
+	void Unregister(USaveIdComponent& Component);
+	void Rekey(USaveIdComponent& Component, const FGuid& OldGuid);
+
+	virtual void Deinitialize() override;
+
+private:
+	TMap<FGuid, TWeakObjectPtr<USaveIdComponent>> ByGuid;
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<USaveIdComponent>> ByActor;
+	TSet<TWeakObjectPtr<USaveIdComponent>> Respawnable;
+};
@@ -0,0 +1,239 @@
+﻿#include "SaveJournal.h"
+#include "FWSCore.h"
+#include "SaveSlotFormat.h"
+#include "SaveSlotStorage.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+	/** 'FWSJ' */
+	constexpr uint32 RecordMagic = 0x4A535746;
+	constexpr int32 RecordHeaderSize = sizeof(uint32) + sizeof(int32) + sizeof(uint32);
+
+	/** Per-object versions of the upserts, in map order (operator<< of FSaveObjectData doesn't carry them). */
+	template <typename KeyType>
+	void SerializeUpsertVersions(FArchive& Ar, TMap<KeyType, FSaveObjectData>& Upserts)
+	{
+		for (TPair<KeyType, FSaveObjectData>& Pair : Upserts)
+		{
+			uint32 Version = Pair.Value.Version;
+			Ar.SerializeIntPacked(Version);
+			if (Version > MAX_int32)
+			{
+				Ar.SetError();
+				return;
+			}
+			Pair.Value.Version = static_cast<int32>(Version);
+		}
+	}
+
+	void SerializeDelta(FArchive& Ar, FSaveDelta& Delta)
+	{
+		Ar << Delta.Sequence;
+		Ar << Delta.SaveVersion;
+		Ar << Delta.SaveTimestamp;
+		Ar << Delta.BuildId;
+		Ar << Delta.ObjectUpserts;
+		Ar << Delta.GuidUpserts;
+		Ar << Delta.ObjectRemovals;
+		Ar << Delta.GuidRemovals;
+		SerializeUpsertVersions(Ar, Delta.ObjectUpserts);
+		SerializeUpsertVersions(Ar, Delta.GuidUpserts);
+	}
+}
+
+namespace SaveJournal
+{
+	FCriticalSection& GetSlotLock(const FString& Slot)
+	{
+		// Locks are never freed: there are only ever a handful of profiles per run.
+		static FCriticalSection MapLock;
+		static TMap<FString, TUniquePtr<FCriticalSection>> Locks;
+
+		FScopeLock Lock(&MapLock);
+		TUniquePtr<FCriticalSection>& Found = Locks.FindOrAdd(SaveSlotStorage::GetProfileSlot(Slot));
+		if (!Found)
+		{
+			Found = MakeUnique<FCriticalSection>();
+		}
+		return *Found;
+	}
+
+	FString GetJournalPath(const FString& Slot)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (Slot + TEXT(".journal"));
+	}
+
+	int64 Append(const FString& Slot, const FSaveDelta& Delta, int64* OutRecordBytes, double* OutEncodeSeconds)
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		TArray<uint8> Payload;
+		{
+			FMemoryWriter Ar(Payload, /*bIsPersistent*/true);
+			SerializeDelta(Ar, const_cast<FSaveDelta&>(Delta));
+		}
+		if (OutEncodeSeconds)
+		{
+			*OutEncodeSeconds = FPlatformTime::Seconds() - StartSeconds;
+		}
+
+		uint32 Magic = RecordMagic;
+		int32 Size = Payload.Num();
+		uint32 Crc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+		const FString Path = GetJournalPath(Slot);
+		TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append));
+		if (!File)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveJournal] Could not open %s for append."), *Path);
+			return INDEX_NONE;
+		}
+
+		*File << Magic;
+		*File << Size;
+		*File << Crc;
+		File->Serialize(Payload.GetData(), Payload.Num());
+		File->Flush();
+
+		const int64 TotalSize = File->TotalSize();
+		const bool bOk = File->Close() && !File->IsError();
+		if (bOk && OutRecordBytes)
+		{
+			*OutRecordBytes = sizeof(Magic) + sizeof(Size) + sizeof(Crc) + Payload.Num();
+		}
+		return bOk ? TotalSize : INDEX_NONE;
+	}
+
+	int32 Replay(const FString& Slot, FSaveSnapshot& Snapshot)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *GetJournalPath(Slot), FILEREAD_Silent))
+		{
+			return 0;
+		}
+
+		TArray<FSaveDelta> Records;
+		int32 Offset = 0;
+		while (Offset + RecordHeaderSize <= Bytes.Num())
+		{
+			uint32 Magic = 0;
+			int32 Size = 0;
+			uint32 Crc = 0;
+			FMemory::Memcpy(&Magic, Bytes.GetData() + Offset, sizeof(uint32));
+			FMemory::Memcpy(&Size,  Bytes.GetData() + Offset + sizeof(uint32), sizeof(int32));
+			FMemory::Memcpy(&Crc,   Bytes.GetData() + Offset + sizeof(uint32) + sizeof(int32), sizeof(uint32));
+
+			const int32 PayloadOffset = Offset + RecordHeaderSize;
+			if (Magic != RecordMagic || Size < 0 || PayloadOffset + Size > Bytes.Num()
+				|| FCrc::MemCrc32(Bytes.GetData() + PayloadOffset, Size) != Crc)
+			{
+				// Torn or corrupt tail (e.g. crash mid-append): everything before it is still valid.
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveJournal] %s: ignoring damaged journal tail at offset %d."), *Slot, Offset);
+				break;
+			}
+
+			FSaveDelta Delta;
+			FMemoryReaderView Ar(TConstArrayView<uint8>(Bytes.GetData() + PayloadOffset, Size), /*bIsPersistent*/true);
+			SerializeDelta(Ar, Delta);
+			if (Ar.IsError())
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveJournal] %s: record at offset %d doesn't decode; ignoring the journal from there."), *Slot, Offset);
+				break;
+			}
+
+			// Records at or below the image's sequence were already folded in by a compaction.
+			if (Delta.Sequence > Snapshot.Sequence)
+			{
+				Records.Add(MoveTemp(Delta));
+			}
+			Offset = PayloadOffset + Size;
+		}
+
+		// Appends from different writers may land out of order; sequence is the source of truth.
+		Records.Sort([](const FSaveDelta& A, const FSaveDelta& B) { return A.Sequence < B.Sequence; });
+
+		// Each record only holds the objects that changed since the one before it, so a missing record (a failed
+		// append, or an older backup image under a newer journal) means everything after it would mix into stale state.
+		int32 Applied = 0;
+		for (const FSaveDelta& Delta : Records)
+		{
+			if (Delta.Sequence == Snapshot.Sequence)
+			{
+				continue; // same record appended twice
+			}
+			if (Delta.Sequence != Snapshot.Sequence + 1)
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveJournal] %s: journal skips from sequence %lld to %lld; ignoring the %d records from there."),
+					*Slot, Snapshot.Sequence, Delta.Sequence, Records.Num() - Applied);
+				break;
+			}
+			Delta.ApplyTo(Snapshot);
+			++Applied;
+		}
+		return Applied;
+	}
+
+	int64 GetSize(const FString& Slot)
+	{
+		const int64 Size = IFileManager::Get().FileSize(*GetJournalPath(Slot));
+		return Size > 0 ? Size : 0;
+	}
+
+	void Discard(const FString& Slot)
+	{
+		IFileManager::Get().Delete(*GetJournalPath(Slot), /*RequireExists*/false, /*EvenReadOnly*/true, /*Quiet*/true);
+	}
+
+	bool Compact(const FString& Slot, int32 NumGenerations, const SaveSlotFormat::FEncodeOptions& Options, int64* OutImageBytes,
+		double* OutEncodeSeconds)
+	{
+		TArray<uint8> OldImage;
+		FSaveSnapshot Snapshot;
+		if (!SaveSlotStorage::ReadNewestValid(Slot, OldImage))
+		{
+			return false;
+		}
+		const double DecodeStart = FPlatformTime::Seconds();
+		if (!SaveSlotFormat::Read(OldImage, Snapshot))
+		{
+			// Can't rebuild without a readable FWS image; the next full save will rewrite it.
+			return false;
+		}
+
+		const int32 Applied = Replay(Slot, Snapshot);
+		if (Applied == 0)
+		{
+			Discard(Slot);
+			return true;
+		}
+
+		TArray<uint8> NewImage;
+		SaveSlotFormat::Write(Snapshot, NewImage, Options);
+		if (OutEncodeSeconds)
+		{
+			*OutEncodeSeconds = FPlatformTime::Seconds() - DecodeStart;
+		}
+
+		// The replaced image becomes generation 1 by rename; no second write.
+		if (!SaveSlotStorage::WriteAtomic(Slot, NewImage, NumGenerations))
+		{
+			return false;
+		}
+
+		// A crash before this point leaves a journal whose records are <= the image sequence: replay skips them.
+		Discard(Slot);
+
+		if (OutImageBytes)
+		{
+			*OutImageBytes = NewImage.Num();
+		}
+
+		UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveJournal] Compacted %s: %d records folded, image %d bytes."),
+			*Slot, Applied, NewImage.Num());
+		return true;
+	}
+}
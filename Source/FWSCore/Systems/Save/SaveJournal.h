@@ -0,0 +1,44 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSystem.h"
+#include "SaveSlotFormat.h"
+
+/**
+ * Append-only per-slot journal of FSaveDelta records, stored next to the slot image.
+ * Each record is framed (magic, size, CRC) so a torn tail from a crash is detected and ignored.
+ * Records carry whole objects, so replay is idempotent and only needs Sequence ordering.
+ * All functions are thread-safe for a given slot while GetSlotLock(Slot) is held.
+ */
+namespace SaveJournal
+{
+	/**
+	 * Serializes slot image + journal I/O between the game thread and save workers.
+	 * One lock per profile (its chunk slots share it), so different profiles' I/O runs in parallel.
+	 */
+	FWSCORE_API FCriticalSection& GetSlotLock(const FString& Slot);
+
+	FWSCORE_API FString GetJournalPath(const FString& Slot);
+
+	/** Appends one record. Returns the journal size in bytes afterwards, or INDEX_NONE on failure. OutEncodeSeconds: record serialization. */
+	FWSCORE_API int64 Append(const FString& Slot, const FSaveDelta& Delta, int64* OutRecordBytes = nullptr, double* OutEncodeSeconds = nullptr);
+
+	/**
+	 * Applies the intact records that continue Snapshot.Sequence without a gap, stopping at the first missing sequence.
+	 * Returns the number of records applied.
+	 */
+	FWSCORE_API int32 Replay(const FString& Slot, FSaveSnapshot& Snapshot);
+
+	/** Size on disk (0 if there is no journal). */
+	FWSCORE_API int64 GetSize(const FString& Slot);
+
+	FWSCORE_API void Discard(const FString& Slot);
+
+	/**
+	 * Folds the journal into a fresh full image: read image, replay, write image, drop journal.
+	 * The previous image rotates into the backup generations (see SaveSlotStorage). Runs on whatever thread calls it.
+	 * OutEncodeSeconds: decode, replay and re-encode, i.e. everything but the file I/O.
+	 */
+	FWSCORE_API bool Compact(const FString& Slot, int32 NumGenerations, const SaveSlotFormat::FEncodeOptions& Options,
+		int64* OutImageBytes = nullptr, double* OutEncodeSeconds = nullptr);
+}
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSystem.h"
+
+/** Upgrades one payload written at the step's FromVersion. False = couldn't; the payload stays at FromVersion. */
+using FSaveMigrationStep = TFunction<bool(FSaveObjectData& Data)>;
+
+/**
+ * Migration steps keyed by the version they upgrade from and the kind of object they apply to.
+ * USaveSystem runs them lazily, the first time a payload older than its SaveVersion is looked up,
+ * so loading an old slot costs nothing until each object is actually used.
+ *
+ * A step's Type matches
+ *  - the class of the saveable a payload is resolved for (LoadData/SaveData, parents included),
+ *  - the object id of a name-keyed payload ("Profile", character ids, ...),
+ *  - every payload when NAME_None.
+ * Register from module startup; lookups happen on the game thread.
+ */
+class FWSCORE_API FSaveMigrationRegistry
+{
+public:
+	static FSaveMigrationRegistry& Get();
+
+	/** Step for the name-keyed payload ObjectId, or for every payload when NAME_None. */
+	FDelegateHandle Register(int32 FromVersion, FName ObjectId, FSaveMigrationStep Step);
+
+	/** Step for the payloads of Class and its subclasses. */
+	FDelegateHandle Register(int32 FromVersion, const UClass* Class, FSaveMigrationStep Step);
+
+	template <typename T>
+	FDelegateHandle Register(int32 FromVersion, FSaveMigrationStep Step) { return Register(FromVersion, T::StaticClass(), MoveTemp(Step)); }
+
+	void Unregister(FDelegateHandle Handle);
+
+	/**
+	 * Runs the steps from Data.Version up to TargetVersion that match ObjectId or Class, then stamps TargetVersion.
+	 * Returns true if any step changed the payload. Stops at the first failing step.
+	 */
+	bool Migrate(FSaveObjectData& Data, int32 TargetVersion, FName ObjectId, const UClass* Class) const;
+
+	/** True if a class-keyed step sits in [FromVersion, ToVersion). */
+	bool HasClassSteps(int32 FromVersion, int32 ToVersion) const;
+
+	bool IsEmpty() const { return Steps.Num() == 0; }
+
+private:
+	FDelegateHandle Add(int32 FromVersion, FName Type, bool bClassType, FSaveMigrationStep Step);
+
+	struct FEntry
+	{
+		/** Class name (bClassType) or object id; NAME_None = any payload. */
+		FName Type;
+		bool bClassType = false;
+		FSaveMigrationStep Step;
+		FDelegateHandle Handle;
+	};
+
+	/** FromVersion -> steps in registration order. */
+	TMap<int32, TArray<FEntry>> Steps;
+};
@@ -0,0 +1,75 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SaveSystemSubsystem.h"
+#include "SaveReadSnapshot.h"
+#include "SaveProfileContext.generated.h"
+
+/**
+ * One local player's mounted profile: its slot, save object, partition chunks and save/load pipeline.
+ * Contexts share nothing but the subsystem's config, so split-screen players read, gather and write side by side;
+ * slot I/O only serializes per profile (SaveJournal::GetSlotLock). State only: USaveSystemSubsystem drives it.
+ */
+UCLASS()
+class FWSCORE_API USaveProfileContext : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** FSaveProfileKey::LocalUserNum of the player. Context 0 is the primary profile and also holds world saveables. */
+	UPROPERTY(VisibleAnywhere, Category="Save System|State")
+	int32 LocalUserNum = 0;
+
+	UPROPERTY(VisibleAnywhere, Category="Save System|State")
+	FString SaveSlotName = TEXT("DefaultSaveSlot");
+
+	/** In-memory save object for the slot. */
+	UPROPERTY(Transient)
+	USaveSystem* CurrentSaveSystem = nullptr;
+
+	/** Save objects of the partitions whose levels are loaded. */
+	UPROPERTY(Transient)
+	TMap<FName, USaveSystem*> ResidentChunks;
+
+	/**
+	 * Chunks of streamed-out levels, by chunk slot, kept until their flush is acknowledged on the game thread.
+	 * A level that streams back in before that takes its chunk from here rather than from the (older) disk copy.
+	 */
+	UPROPERTY(Transient)
+	TMap<FString, USaveSystem*> FlushingChunks;
+
+	/** FlushingChunks entries whose write failed; flushed again (as a full image) with the profile's next save. */
+	TSet<FString> FailedChunkFlushes;
+
+	/** True from an async load's start until OnLoadFinished. */
+	bool IsLoadInProgress() const { return PendingRead.IsValid() || !PendingLoad.IsDone(); }
+
+	/** Time-sliced load in progress: resolved payloads for PendingLoadSave. */
+	FSaveLoadBatch PendingLoad;
+	TWeakObjectPtr<USaveSystem> PendingLoadSave;
+	FTimerHandle LoadSliceHandle;
+
+	/** Async load still reading on the worker; a result whose read isn't PendingRead anymore is dropped. */
+	TSharedPtr<USaveSystemSubsystem::FAsyncSlotRead, ESPMode::ThreadSafe> PendingRead;
+	UE::Tasks::FTask PendingReadTask;
+
+	/** Slot reported by OnLoadFinished for the pending load. */
+	FString PendingLoadSlot;
+
+	/** Cost of the pending load so far; reported through OnSaveStats when it finishes or is cancelled. */
+	FSaveStats PendingLoadStats;
+
+	/** Prevent overlapping async saves. */
+	bool bSaveInFlight = false;
+
+	/** Async save still running SaveData slices (bSaveInFlight stays set through it). */
+	USaveSystemSubsystem::FSaveGatherBatch PendingGather;
+	FTimerHandle GatherSliceHandle;
+
+	/** Last worker write of this profile (each one chained after the previous); synchronous writes wait on it. */
+	UE::Tasks::FTask PendingWriteTask;
+
+	/** Read snapshots of CurrentSaveSystem, published on every load, save and subsystem edit; handed out to other threads. */
+	TSharedRef<FSaveSnapshotChannel, ESPMode::ThreadSafe> ReadSnapshots = MakeShared<FSaveSnapshotChannel, ESPMode::ThreadSafe>();
+};
@@ -0,0 +1,165 @@
+﻿#include "SaveProfileIndex.h"
+#include "FWSCore.h"
+#include "SaveSlotStorage.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+	/** 'FWSP' */
+	constexpr uint32 IndexMagic = 0x50535746;
+	constexpr int32 IndexVersion = 1;
+
+	void SerializeEntry(FArchive& Ar, FProfileSlotInfo& Info)
+	{
+		Ar << Info.SlotName;
+		Ar << Info.DisplayName;
+		Ar << Info.Platform;
+		Ar << Info.Namespace;
+		Ar << Info.LocalUserNum;
+		Ar << Info.LastSaved;
+		Ar << Info.SizeBytes;
+	}
+}
+
+namespace SaveProfileIndex
+{
+	FString GetIndexPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("Profiles.index");
+	}
+
+	bool Load(TArray<FProfileSlotInfo>& OutEntries)
+	{
+		OutEntries.Reset();
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *GetIndexPath(), FILEREAD_Silent))
+		{
+			return false;
+		}
+
+		FMemoryReader Ar(Bytes, /*bIsPersistent*/true);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		uint32 Crc = 0;
+		Ar << Magic;
+		Ar << Version;
+		Ar << Crc;
+
+		const int64 BodyStart = Ar.Tell();
+		if (Ar.IsError() || Magic != IndexMagic || Version <= 0 || Version > IndexVersion
+			|| FCrc::MemCrc32(Bytes.GetData() + BodyStart, Bytes.Num() - BodyStart) != Crc)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveProfileIndex] %s is damaged; it will be rebuilt."), *GetIndexPath());
+			return false;
+		}
+
+		int32 Num = 0;
+		Ar << Num;
+		if (Num < 0 || Num > Bytes.Num()) return false;
+
+		OutEntries.SetNum(Num);
+		for (int32 i = 0; i < OutEntries.Num() && !Ar.IsError(); ++i)
+		{
+			SerializeEntry(Ar, OutEntries[i]);
+		}
+		if (Ar.IsError())
+		{
+			OutEntries.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	bool Save(const TArray<FProfileSlotInfo>& Entries)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar(Bytes, /*bIsPersistent*/true);
+
+		uint32 Magic = IndexMagic;
+		int32 Version = IndexVersion;
+		uint32 Crc = 0; // patched below
+		Ar << Magic;
+		Ar << Version;
+		Ar << Crc;
+
+		const int64 BodyStart = Ar.Tell();
+		int32 Num = Entries.Num();
+		Ar << Num;
+		for (const FProfileSlotInfo& Entry : Entries)
+		{
+			SerializeEntry(Ar, const_cast<FProfileSlotInfo&>(Entry));
+		}
+
+		Crc = FCrc::MemCrc32(Bytes.GetData() + BodyStart, Bytes.Num() - BodyStart);
+		FMemory::Memcpy(Bytes.GetData() + sizeof(uint32) + sizeof(int32), &Crc, sizeof(uint32));
+
+		const FString Path = GetIndexPath();
+		const FString Temp = Path + TEXT(".tmp");
+		return FFileHelper::SaveArrayToFile(Bytes, *Temp)
+			&& IFileManager::Get().Move(*Path, *Temp, /*Replace*/true, /*EvenIfReadOnly*/true, /*Attributes*/false, /*bDoNotRetryOrError*/true);
+	}
+
+	FProfileSlotInfo MakeEntry(const FString& Slot)
+	{
+		FProfileSlotInfo Info;
+		Info.SlotName = Slot;
+		Info.Platform = TEXT("Local");
+		Info.Namespace = TEXT("Default");
+
+		// Slots named by FSaveProfileKey::ToSlotName carry platform/namespace/user index.
+		TArray<FString> Parts;
+		if (Slot.StartsWith(TEXT("Profile_")) && Slot.ParseIntoArray(Parts, TEXT("_")) >= 5)
+		{
+			Info.Platform = Parts[1];
+			Info.Namespace = Parts[2];
+			Info.LocalUserNum = FCString::Atoi(*Parts[3]);
+		}
+		return Info;
+	}
+
+	void BuildFromDisk(TArray<FProfileSlotInfo>& OutEntries)
+	{
+		OutEntries.Reset();
+
+		TArray<FString> Slots;
+		if (ISaveGameSystem* UESaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem())
+		{
+			UESaveSystem->GetSaveGameNames(Slots, 0);
+		}
+
+		for (const FString& Slot : Slots)
+		{
+			// Partition chunks belong to their profile; they aren't profiles themselves.
+			if (SaveSlotStorage::IsChunkSlot(Slot)) continue;
+
+			FProfileSlotInfo Info = MakeEntry(Slot);
+			Info.LastSaved = IFileManager::Get().GetTimeStamp(*SaveSlotStorage::GetSlotPath(Slot));
+			Info.SizeBytes = SaveSlotStorage::GetSize(Slot);
+			Upsert(OutEntries, Info);
+		}
+	}
+
+	void Upsert(TArray<FProfileSlotInfo>& Entries, const FProfileSlotInfo& Info)
+	{
+		Remove(Entries, Info.SlotName);
+
+		int32 Insert = 0;
+		while (Insert < Entries.Num() && Entries[Insert].LastSaved >= Info.LastSaved)
+		{
+			++Insert;
+		}
+		Entries.Insert(Info, Insert);
+	}
+
+	bool Remove(TArray<FProfileSlotInfo>& Entries, const FString& Slot)
+	{
+		return Entries.RemoveAll([&Slot](const FProfileSlotInfo& Entry) { return Entry.SlotName == Slot; }) > 0;
+	}
+}
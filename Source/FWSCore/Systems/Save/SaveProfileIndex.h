@@ -0,0 +1,32 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "FWSCore/Shared/FWSTypes.h"
+
+/**
+ * Sidecar index of profile slots ("Saved/SaveGames/Profiles.index").
+ * Lets profile pickers and startup slot resolution list slots with display names,
+ * sizes and timestamps without deserializing any USaveSystem. Game thread only.
+ */
+namespace SaveProfileIndex
+{
+	FWSCORE_API FString GetIndexPath();
+
+	/** False if the index is missing or damaged (callers then rebuild it). */
+	FWSCORE_API bool Load(TArray<FProfileSlotInfo>& OutEntries);
+
+	/** Rewrites the index (temp file + replace). */
+	FWSCORE_API bool Save(const TArray<FProfileSlotInfo>& Entries);
+
+	/** Fresh entry for a slot; platform/namespace/user index are parsed from FSaveProfileKey-style names. */
+	FWSCORE_API FProfileSlotInfo MakeEntry(const FString& Slot);
+
+	/** Builds entries from the slot files alone (no slot is decoded, so DisplayName stays empty). */
+	FWSCORE_API void BuildFromDisk(TArray<FProfileSlotInfo>& OutEntries);
+
+	/** Inserts or replaces the entry for Info.SlotName, keeping the list newest-first. */
+	FWSCORE_API void Upsert(TArray<FProfileSlotInfo>& Entries, const FProfileSlotInfo& Info);
+
+	/** Returns true if an entry was removed. */
+	FWSCORE_API bool Remove(TArray<FProfileSlotInfo>& Entries, const FString& Slot);
+}
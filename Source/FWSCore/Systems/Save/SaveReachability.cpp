@@ -0,0 +1,89 @@
+﻿#include "SaveReachability.h"
+#include "FWSCore.h"
+#include "SaveSystem.h"
+#include "SaveSystemSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+namespace
+{
+	static const FName SeenLevelKey(TEXT("__SeenLevel"));
+	static const FName SeenSessionKey(TEXT("__SeenSession"));
+}
+
+const FName SaveReachability::SessionsObjectId(TEXT("__Sessions"));
+
+FName SaveReachability::GetLevelId(const ULevel* Level)
+{
+	return Level ? FName(*UWorld::RemovePIEPrefix(Level->GetPackage()->GetName())) : NAME_None;
+}
+
+bool SaveReachability::ReadLog(const USaveSystem& Save, FSaveSessionLog& OutLog)
+{
+	return Save.GetStruct(SessionsObjectId, OutLog);
+}
+
+void SaveReachability::TouchLevels(USaveSystem& Save, TConstArrayView<FName> LevelIds, FSaveSessionLog& OutLog)
+{
+	OutLog = FSaveSessionLog();
+	ReadLog(Save, OutLog);
+
+	const FGuid Session = FApp::GetSessionId();
+	bool bChanged = false;
+	for (const FName& LevelId : LevelIds)
+	{
+		FSaveLevelSessions& Sessions = OutLog.Levels.FindOrAdd(LevelId);
+		if (Sessions.LastSession != Session)
+		{
+			Sessions.LastSession = Session;
+			++Sessions.Count;
+			bChanged = true;
+		}
+	}
+	if (bChanged)
+	{
+		Save.SetStruct(SessionsObjectId, OutLog);
+	}
+}
+
+void SaveReachability::MarkSeen(FSaveObjectData& Data, FName LevelId, const FSaveSessionLog& Log)
+{
+	const FSaveLevelSessions* Sessions = Log.Levels.Find(LevelId);
+	Data.SetName(SeenLevelKey, LevelId);
+	Data.SetInt(SeenSessionKey, Sessions ? Sessions->Count : 0);
+}
+
+int32 SaveReachability::GetSessionsUnseen(const FSaveObjectData& Data, const FSaveSessionLog& Log)
+{
+	FName LevelId;
+	int32 Seen = 0;
+	if (!Data.GetName(SeenLevelKey, LevelId) || !Data.GetInt(SeenSessionKey, Seen))
+	{
+		return INDEX_NONE;
+	}
+	const FSaveLevelSessions* Sessions = Log.Levels.Find(LevelId);
+	return Sessions ? FMath::Max(0, Sessions->Count - Seen) : 0;
+}
+
+namespace
+{
+	void CompactSaveData(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		USaveSystemSubsystem* SaveSub = GI ? GI->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+		if (!SaveSub)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveReachability] No SaveSystemSubsystem in this world."));
+			return;
+		}
+		SaveSub->CompactSaveData();
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs GSaveCompactCmd(
+		TEXT("FWS.Save.Compact"),
+		TEXT("FWS.Save.Compact - prunes GUID payloads of actors not seen for StaleRetentionSessions sessions of their level and logs the bytes reclaimed."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&CompactSaveData));
+}
@@ -0,0 +1,94 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveReachability.generated.h"
+
+class ULevel;
+class USaveSystem;
+struct FSaveObjectData;
+
+/** Sessions in which one level was loaded (and saved) while a save object was mounted. */
+USTRUCT()
+struct FSaveLevelSessions
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	/** FApp::GetSessionId() of the last session counted. */
+	UPROPERTY()
+	FGuid LastSession;
+};
+
+/** Session counters of the levels of one save object; the struct payload of its SaveReachability::SessionsObjectId object. */
+USTRUCT()
+struct FSaveSessionLog
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TMap<FName, FSaveLevelSessions> Levels;
+};
+
+/** Result of one compaction pass over the mounted profiles (USaveSystemSubsystem::CompactSaveData). */
+USTRUCT(BlueprintType)
+struct FWSCORE_API FSaveCompactionStats
+{
+	GENERATED_BODY()
+
+	/** Save objects walked: profile slots and the chunks of loaded levels. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 SaveObjects = 0;
+
+	/** GUID payloads looked at. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 Checked = 0;
+
+	/** GUID payloads removed because their actor hasn't been seen for the retention period. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 Pruned = 0;
+
+	/** GUID payloads whose actor was never seen since tracking started (older saves); always kept. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 Untracked = 0;
+
+	/** Encoded size of the pruned payloads; the next full image of each slot is that much smaller. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int64 BytesReclaimed = 0;
+
+	/** Game thread, summed over frames. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float GameThreadMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 Frames = 0;
+};
+
+/**
+ * Reachability of GUID payloads. Saves stamp the payload of every live SaveId actor with its level and that level's
+ * session count; a level counts a session when it is saved while loaded. A payload whose level has counted
+ * RetentionSessions sessions since its last stamp belongs to an actor that is gone (destroyed without a tombstone,
+ * a runtime actor that won't come back, or removed from the level) and can be pruned. Levels the player doesn't
+ * return to don't count sessions, so their payloads never age. Game thread only.
+ */
+namespace SaveReachability
+{
+	/** Name-keyed object holding a save object's FSaveSessionLog. */
+	FWSCORE_API extern const FName SessionsObjectId;
+
+	/** Stable id of a level across runs: its package name without the PIE prefix. */
+	FWSCORE_API FName GetLevelId(const ULevel* Level);
+
+	/** False if the save object has no session log yet. */
+	FWSCORE_API bool ReadLog(const USaveSystem& Save, FSaveSessionLog& OutLog);
+
+	/** Counts the current session for each of LevelIds (once per session each) and returns the updated log. */
+	FWSCORE_API void TouchLevels(USaveSystem& Save, TConstArrayView<FName> LevelIds, FSaveSessionLog& OutLog);
+
+	/** Stamps a payload as seen now in LevelId; dirties it only on the first sighting of a session. */
+	FWSCORE_API void MarkSeen(FSaveObjectData& Data, FName LevelId, const FSaveSessionLog& Log);
+
+	/** Sessions of its level since the payload was last stamped; INDEX_NONE if it never was. */
+	FWSCORE_API int32 GetSessionsUnseen(const FSaveObjectData& Data, const FSaveSessionLog& Log);
+}
@@ -0,0 +1,87 @@
+﻿#include "SaveReadSnapshot.h"
+
+namespace
+{
+	template <typename KeyType>
+	FSaveReadSnapshot::FObjectPtr FindInSnapshot(const TMap<KeyType, FSaveReadSnapshot::FObjectPtr>& Decoded,
+		const FSaveObjectIndex* Undecoded, const TMap<KeyType, FSaveObjectRange>* Ranges, const KeyType& Key)
+	{
+		if (const FSaveReadSnapshot::FObjectPtr* Found = Decoded.Find(Key))
+		{
+			return *Found;
+		}
+		const FSaveObjectRange* Range = Ranges ? Ranges->Find(Key) : nullptr;
+		if (!Range) return nullptr;
+
+		// The index and its buffer are immutable, so decoding from any thread is safe.
+		TSharedRef<FSaveObjectData, ESPMode::ThreadSafe> Data = MakeShared<FSaveObjectData, ESPMode::ThreadSafe>();
+		return Undecoded->Decode(*Range, *Data) ? FSaveReadSnapshot::FObjectPtr(Data) : nullptr;
+	}
+
+	template <typename KeyType>
+	bool FindVersionInSnapshot(const TMap<KeyType, FSaveReadSnapshot::FObjectPtr>& Decoded,
+		const TMap<KeyType, FSaveObjectRange>* Ranges, const KeyType& Key, int32& OutVersion)
+	{
+		if (const FSaveReadSnapshot::FObjectPtr* Found = Decoded.Find(Key))
+		{
+			OutVersion = (*Found)->Version;
+			return true;
+		}
+		if (const FSaveObjectRange* Range = Ranges ? Ranges->Find(Key) : nullptr)
+		{
+			OutVersion = Range->Version;
+			return true;
+		}
+		return false;
+	}
+}
+
+FSaveReadSnapshot::FObjectPtr FSaveReadSnapshot::FindObject(FName ObjectId) const
+{
+	return FindInSnapshot(Named, Undecoded.Get(), Undecoded.IsValid() ? &Undecoded->Named : nullptr, ObjectId);
+}
+
+FSaveReadSnapshot::FObjectPtr FSaveReadSnapshot::FindObjectByGuid(const FGuid& Guid) const
+{
+	return FindInSnapshot(Guids, Undecoded.Get(), Undecoded.IsValid() ? &Undecoded->Guids : nullptr, Guid);
+}
+
+bool FSaveReadSnapshot::GetField(FName ObjectId, FName Key, FString& OutValue) const
+{
+	const FObjectPtr Object = FindObject(ObjectId);
+	return Object.IsValid() && Object->GetField(Key, OutValue);
+}
+
+bool FSaveReadSnapshot::GetObjectVersion(FName ObjectId, int32& OutVersion) const
+{
+	return FindVersionInSnapshot(Named, Undecoded.IsValid() ? &Undecoded->Named : nullptr, ObjectId, OutVersion);
+}
+
+bool FSaveReadSnapshot::GetObjectVersionByGuid(const FGuid& Guid, int32& OutVersion) const
+{
+	return FindVersionInSnapshot(Guids, Undecoded.IsValid() ? &Undecoded->Guids : nullptr, Guid, OutVersion);
+}
+
+void FSaveReadSnapshot::GetObjectIds(TArray<FName>& OutIds) const
+{
+	Named.GetKeys(OutIds);
+	if (Undecoded.IsValid())
+	{
+		for (const TPair<FName, FSaveObjectRange>& Pair : Undecoded->Named)
+		{
+			OutIds.Add(Pair.Key);
+		}
+	}
+}
+
+void FSaveReadSnapshot::GetGuids(TArray<FGuid>& OutGuids) const
+{
+	Guids.GetKeys(OutGuids);
+	if (Undecoded.IsValid())
+	{
+		for (const TPair<FGuid, FSaveObjectRange>& Pair : Undecoded->Guids)
+		{
+			OutGuids.Add(Pair.Key);
+		}
+	}
+}
@@ -0,0 +1,101 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
+#include "SaveSystem.h"
+
+/**
+ * Immutable, reference-counted view of a profile's save object as of one publish (each save, load and subsystem edit).
+ * Payloads are shared with the previous snapshot unless they changed in between (copy-on-write per object), and
+ * undecoded ones stay in the slot image's shared buffer, so publishing costs a map of pointers rather than a copy
+ * of the save. Nothing in a snapshot ever changes: any thread may hold and read one without locks.
+ *
+ * Reads are not migrated. Migration steps are game-thread code and run when the save object itself reaches a payload,
+ * so a snapshot returns whatever layout that payload had at publish time. A payload whose Version is below
+ * GetSaveVersion() still follows an older layout: check it (GetObjectVersion) before relying on renamed or retyped fields.
+ */
+class FWSCORE_API FSaveReadSnapshot
+{
+public:
+	using FObjectPtr = TSharedPtr<const FSaveObjectData, ESPMode::ThreadSafe>;
+
+	/**
+	 * Payload of a name-keyed object, unmigrated (see the class comment). Ones still undecoded in the slot image come
+	 * back as a new decoded copy, not cached. Null if there is none.
+	 */
+	FObjectPtr FindObject(FName ObjectId) const;
+	FObjectPtr FindObjectByGuid(const FGuid& Guid) const;
+
+	/** One field as text (see FSaveFieldStore::GetAsString), in the payload's own layout. */
+	bool GetField(FName ObjectId, FName Key, FString& OutValue) const;
+
+	/** FSaveObjectData::Version of a payload, without decoding it. False if there is none. */
+	bool GetObjectVersion(FName ObjectId, int32& OutVersion) const;
+	bool GetObjectVersionByGuid(const FGuid& Guid, int32& OutVersion) const;
+
+	/** Keys of every payload, decoded or not (decodes nothing). */
+	void GetObjectIds(TArray<FName>& OutIds) const;
+	void GetGuids(TArray<FGuid>& OutGuids) const;
+
+	int32 GetNumObjects() const { return Named.Num() + Guids.Num() + (Undecoded.IsValid() ? Undecoded->Num() : 0); }
+
+	int32 GetSaveVersion() const { return SaveVersion; }
+	FDateTime GetSaveTimestamp() const { return SaveTimestamp; }
+
+	/** USaveSystem::SaveSequence at publish time: later snapshots of the same profile have a higher or equal one. */
+	int64 GetSequence() const { return Sequence; }
+
+private:
+	friend class USaveSystem;
+
+	TMap<FName, FObjectPtr> Named;
+	TMap<FGuid, FObjectPtr> Guids;
+
+	/** Objects not decoded at publish time; shared between snapshots while the save object's index doesn't change. */
+	TSharedPtr<const FSaveObjectIndex, ESPMode::ThreadSafe> Undecoded;
+
+	int32 SaveVersion = 1;
+	FDateTime SaveTimestamp;
+	int64 Sequence = 0;
+
+	/** Save object and USaveSystem::SnapshotEpoch this was taken from; payloads are only shared within the same pair. */
+	FObjectKey Source;
+	uint32 Epoch = 0;
+};
+
+using FSaveReadSnapshotPtr = TSharedPtr<const FSaveReadSnapshot, ESPMode::ThreadSafe>;
+
+/**
+ * Latest read snapshot of one mounted profile. Keep the channel (not the subsystem or the save object) on a worker
+ * to pick up newer snapshots; the lock only covers swapping the pointer, never reading the data.
+ */
+class FWSCORE_API FSaveSnapshotChannel
+{
+public:
+	/** Null until the profile has been loaded or saved once. */
+	FSaveReadSnapshotPtr Get() const
+	{
+		FReadScopeLock Lock(Mutex);
+		return Latest;
+	}
+
+	/** Bumped by every publish, so pollers can skip snapshots they have seen. */
+	uint64 GetGeneration() const { return Generation.load(std::memory_order_acquire); }
+
+	/** GT. */
+	void Publish(FSaveReadSnapshotPtr Snapshot)
+	{
+		{
+			FWriteScopeLock Lock(Mutex);
+			Latest = MoveTemp(Snapshot);
+		}
+		Generation.fetch_add(1, std::memory_order_release);
+	}
+
+private:
+	mutable FRWLock Mutex;
+	FSaveReadSnapshotPtr Latest;
+	std::atomic<uint64> Generation { 0 };
+};
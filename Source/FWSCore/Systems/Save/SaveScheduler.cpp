@@ -0,0 +1,86 @@
+﻿#include "SaveScheduler.h"
+
+void FSaveScheduler::Submit(int32 LocalUserNum, ESavePriority Priority, bool bAsync, double NowSeconds)
+{
+	if (FEntry* Entry = Pending.Find(LocalUserNum))
+	{
+		Entry->Priority = FMath::Max(Entry->Priority, Priority);
+		Entry->bAsync &= bAsync;
+		Entry->LastSeconds = NowSeconds;
+		++NumCoalesced;
+		return;
+	}
+
+	FEntry& Entry = Pending.Add(LocalUserNum);
+	Entry.Priority = Priority;
+	Entry.bAsync = bAsync;
+	Entry.FirstSeconds = NowSeconds;
+	Entry.LastSeconds = NowSeconds;
+}
+
+void FSaveScheduler::Cancel(int32 LocalUserNum)
+{
+	Pending.Remove(LocalUserNum);
+}
+
+void FSaveScheduler::Reset()
+{
+	Pending.Reset();
+	LastWriteSeconds = -UE_DOUBLE_BIG_NUMBER;
+	NumCoalesced = 0;
+}
+
+bool FSaveScheduler::IsReady(const FEntry& Entry, double NowSeconds, float LastFrameMs) const
+{
+	if (NowSeconds - Entry.FirstSeconds >= Policy.MaxDelaySeconds)
+	{
+		return true;
+	}
+	if (Entry.Priority == ESavePriority::High)
+	{
+		return true;
+	}
+	if (Entry.Priority == ESavePriority::Normal && NowSeconds - Entry.LastSeconds < Policy.SettleSeconds)
+	{
+		return false;
+	}
+	if (NowSeconds - LastWriteSeconds < Policy.MinIntervalSeconds)
+	{
+		return false;
+	}
+	return Policy.FrameBudgetMs <= 0.f || LastFrameMs <= Policy.FrameBudgetMs;
+}
+
+bool FSaveScheduler::PickNext(double NowSeconds, float LastFrameMs, bool bWriteInFlight, int32& OutLocalUserNum, bool& bOutAsync)
+{
+	if (bWriteInFlight || Pending.Num() == 0)
+	{
+		return false;
+	}
+
+	const FEntry* Best = nullptr;
+	int32 BestUser = INDEX_NONE;
+	for (const TPair<int32, FEntry>& Pair : Pending)
+	{
+		const FEntry& Entry = Pair.Value;
+		if (!IsReady(Entry, NowSeconds, LastFrameMs))
+		{
+			continue;
+		}
+		if (!Best || Entry.Priority > Best->Priority || (Entry.Priority == Best->Priority && Entry.FirstSeconds < Best->FirstSeconds))
+		{
+			Best = &Entry;
+			BestUser = Pair.Key;
+		}
+	}
+	if (!Best)
+	{
+		return false;
+	}
+
+	OutLocalUserNum = BestUser;
+	bOutAsync = Best->bAsync;
+	Pending.Remove(BestUser);
+	LastWriteSeconds = NowSeconds;
+	return true;
+}
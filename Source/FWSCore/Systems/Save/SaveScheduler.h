@@ -0,0 +1,79 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveScheduler.generated.h"
+
+/** How soon a save request wants its profile written. */
+UENUM(BlueprintType)
+enum class ESavePriority : uint8
+{
+	/** Autosave: takes any write window, and goes out at the latest MaxDelaySeconds after it was requested. */
+	Background,
+	/** Gameplay progress: waits for the changes to settle, then takes the next write window. */
+	Normal,
+	/** Player-visible (settings, profile edits, deletions): next window, without settling or frame-budget checks. */
+	High
+};
+
+/**
+ * Decides when each mounted profile is written. Every producer (RequestSave, autosave, character components, ...)
+ * submits a dirty notification; the notifications of one profile merge into one pending write, and writes go out
+ * one at a time, at least MinIntervalSeconds apart, and not on frames that already ran over FrameBudgetMs.
+ * Pure policy: USaveSystemSubsystem ticks it and runs the saves it picks. Game thread only.
+ */
+class FWSCORE_API FSaveScheduler
+{
+public:
+	struct FPolicy
+	{
+		/** Normal requests wait until no new one came in for this long (debounce). */
+		float SettleSeconds = 0.25f;
+
+		/** Shortest time between the starts of two writes (any profiles). High skips it. */
+		float MinIntervalSeconds = 2.f;
+
+		/** A pending write goes out at most this long after its first request, whatever the frame time. */
+		float MaxDelaySeconds = 10.f;
+
+		/** Writes wait while the previous frame took longer than this (ms). 0 = don't look at frame time. */
+		float FrameBudgetMs = 50.f;
+	};
+
+	FPolicy Policy;
+
+	/** Merges into the profile's pending write: the highest priority wins, and any synchronous request makes it synchronous. */
+	void Submit(int32 LocalUserNum, ESavePriority Priority, bool bAsync, double NowSeconds);
+
+	/** Drops a profile's pending write (it was written directly, or unmounted). */
+	void Cancel(int32 LocalUserNum);
+	void Reset();
+
+	bool IsPending(int32 LocalUserNum) const { return Pending.Contains(LocalUserNum); }
+	bool HasPending() const { return Pending.Num() > 0; }
+
+	/**
+	 * The pending write to start now, if a window is open; it leaves the pending set and counts as started.
+	 * Never picks one while bWriteInFlight. Highest priority first, then the longest waiting.
+	 */
+	bool PickNext(double NowSeconds, float LastFrameMs, bool bWriteInFlight, int32& OutLocalUserNum, bool& bOutAsync);
+
+	/** Requests merged into an already pending write since the last Reset. */
+	int32 GetNumCoalesced() const { return NumCoalesced; }
+
+private:
+	struct FEntry
+	{
+		ESavePriority Priority = ESavePriority::Background;
+		bool bAsync = true;
+		double FirstSeconds = 0.0;
+		double LastSeconds = 0.0;
+	};
+
+	bool IsReady(const FEntry& Entry, double NowSeconds, float LastFrameMs) const;
+
+	/** By LocalUserNum. */
+	TMap<int32, FEntry> Pending;
+
+	double LastWriteSeconds = -UE_DOUBLE_BIG_NUMBER;
+	int32 NumCoalesced = 0;
+};
@@ -0,0 +1,490 @@
+﻿#include "SaveSlotFormat.h"
+#include "FWSCore.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Compression.h"
+
+/* ---------- Payload serialization ---------- */
+
+FArchive& operator<<(FArchive& Ar, FSaveObjectData& Data)
+{
+	// Legacy SavedFields are folded into Fields (BP may still write them directly), so only typed data is written.
+	if (Ar.IsSaving() && Data.SavedFields.Num() > 0)
+	{
+		Data.UpgradeLegacyFields();
+	}
+	Ar << Data.Fields;
+	Ar << Data.BinaryPayload;
+	return Ar;
+}
+
+/* ---------- Object index ---------- */
+
+namespace
+{
+	/** Object: compact field rows, then the binary payload with a varint length. */
+	void WriteObjectCompact(FArchive& Ar, FSaveObjectData& Data, FSaveNameDictionary& Dictionary)
+	{
+		if (Data.SavedFields.Num() > 0)
+		{
+			Data.UpgradeLegacyFields();
+		}
+		Data.Fields.WriteCompact(Ar, Dictionary);
+
+		uint32 PayloadSize = Data.BinaryPayload.Num();
+		Ar.SerializeIntPacked(PayloadSize);
+		Ar.Serialize(Data.BinaryPayload.GetData(), PayloadSize);
+	}
+
+	bool ReadObjectCompact(FArchive& Ar, FSaveObjectData& Out, TConstArrayView<FName> Dictionary)
+	{
+		if (!Out.Fields.ReadCompact(Ar, Dictionary)) return false;
+
+		uint32 PayloadSize = 0;
+		Ar.SerializeIntPacked(PayloadSize);
+		if (Ar.IsError() || PayloadSize > Ar.TotalSize() - Ar.Tell()) return false;
+
+		Out.BinaryPayload.SetNumUninitialized(PayloadSize);
+		Ar.Serialize(Out.BinaryPayload.GetData(), PayloadSize);
+		return !Ar.IsError();
+	}
+}
+
+TConstArrayView<uint8> FSaveObjectIndex::GetBytes(const FSaveObjectRange& Range) const
+{
+	check(Payload.IsValid());
+	return TConstArrayView<uint8>(Payload->GetData() + Range.Offset, Range.Length);
+}
+
+bool FSaveObjectIndex::Decode(const FSaveObjectRange& Range, FSaveObjectData& Out) const
+{
+	FMemoryReaderView Ar(GetBytes(Range), /*bIsPersistent*/true);
+	Out.Version = Range.Version;
+	return Names.IsValid() && ReadObjectCompact(Ar, Out, *Names);
+}
+
+namespace
+{
+	template <typename KeyType>
+	bool TakeFromIndex(FSaveObjectIndex& Index, TMap<KeyType, FSaveObjectRange>& Map, const KeyType& Key, FSaveObjectData& Out)
+	{
+		const FSaveObjectRange* Range = Map.Find(Key);
+		if (!Range) return false;
+
+		// A damaged object stays indexed, so its bytes still pass through to the next write instead of vanishing.
+		FSaveObjectData Decoded;
+		if (!Index.Decode(*Range, Decoded))
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotFormat] Object %s failed to decode; keeping its encoded bytes"), *LexToString(Key));
+			return false;
+		}
+
+		Map.Remove(Key);
+		Out = MoveTemp(Decoded);
+		if (Index.IsEmpty())
+		{
+			Index.Payload.Reset();
+			Index.Names.Reset();
+		}
+		return true;
+	}
+
+	/** Moves every entry Target doesn't have yet into it; ones that fail to decode are logged and stay in Map. */
+	template <typename KeyType>
+	void DecodeEntriesInto(const FSaveObjectIndex& Index, TMap<KeyType, FSaveObjectRange>& Map, TMap<KeyType, FSaveObjectData>& Target)
+	{
+		Target.Reserve(Target.Num() + Map.Num());
+		for (auto It = Map.CreateIterator(); It; ++It)
+		{
+			if (!Target.Contains(It.Key()))
+			{
+				FSaveObjectData Decoded;
+				if (!Index.Decode(It.Value(), Decoded))
+				{
+					UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotFormat] Object %s failed to decode; keeping its encoded bytes"), *LexToString(It.Key()));
+					continue;
+				}
+				Target.Add(It.Key(), MoveTemp(Decoded));
+			}
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FSaveObjectIndex::Take(FName ObjectId, FSaveObjectData& Out)
+{
+	return TakeFromIndex(*this, Named, ObjectId, Out);
+}
+
+bool FSaveObjectIndex::Take(const FGuid& Guid, FSaveObjectData& Out)
+{
+	return TakeFromIndex(*this, Guids, Guid, Out);
+}
+
+void FSaveObjectIndex::DecodeAllInto(FPlayerSaveData& Target)
+{
+	DecodeEntriesInto(*this, Named, Target.ObjectData);
+	DecodeEntriesInto(*this, Guids, Target.GuidObjectData);
+	if (IsEmpty())
+	{
+		Reset();
+	}
+}
+
+/* ---------- Container ---------- */
+
+namespace
+{
+	ECompressionFlags ToCompressionFlags(ESaveCompressionLevel Level)
+	{
+		switch (Level)
+		{
+		case ESaveCompressionLevel::Fastest:  return COMPRESS_BiasSpeed;
+		case ESaveCompressionLevel::Smallest: return COMPRESS_BiasSize;
+		default:                              return COMPRESS_NoFlags;
+		}
+	}
+
+	/** Index entry: key, then the object's length and version; offsets follow from the order (named first, then GUIDs). */
+	void WriteIndexKey(FArchive& Ar, FName& Key, FSaveNameDictionary& Dictionary)
+	{
+		uint32 NameIndex = Dictionary.Add(Key);
+		Ar.SerializeIntPacked(NameIndex);
+	}
+
+	void WriteIndexKey(FArchive& Ar, FGuid& Key, FSaveNameDictionary&)
+	{
+		Ar << Key;
+	}
+
+	template <typename KeyType>
+	void WriteIndex(FArchive& Ar, TArray<TPair<KeyType, FSaveObjectRange>>& Index, FSaveNameDictionary& Dictionary)
+	{
+		uint32 Num = Index.Num();
+		Ar.SerializeIntPacked(Num);
+		for (TPair<KeyType, FSaveObjectRange>& Entry : Index)
+		{
+			WriteIndexKey(Ar, Entry.Key, Dictionary);
+			uint32 Length = Entry.Value.Length;
+			uint32 Version = Entry.Value.Version;
+			Ar.SerializeIntPacked(Length);
+			Ar.SerializeIntPacked(Version);
+		}
+	}
+
+	bool ReadIndexKey(FArchive& Ar, FName& Key, TConstArrayView<FName> Dictionary)
+	{
+		uint32 NameIndex = 0;
+		Ar.SerializeIntPacked(NameIndex);
+		if (Ar.IsError() || NameIndex >= static_cast<uint32>(Dictionary.Num())) return false;
+		Key = Dictionary[NameIndex];
+		return true;
+	}
+
+	bool ReadIndexKey(FArchive& Ar, FGuid& Key, TConstArrayView<FName>)
+	{
+		Ar << Key;
+		return !Ar.IsError();
+	}
+
+	template <typename KeyType>
+	bool ReadIndex(FArchive& Ar, TMap<KeyType, FSaveObjectRange>& Index, TConstArrayView<FName> Dictionary, int64& InOutOffset)
+	{
+		uint32 Num = 0;
+		Ar.SerializeIntPacked(Num);
+		if (Ar.IsError() || Num > Ar.TotalSize() - Ar.Tell()) return false;
+
+		Index.Reserve(Num);
+		for (uint32 i = 0; i < Num; ++i)
+		{
+			KeyType Key;
+			uint32 Length = 0;
+			uint32 Version = 0;
+			if (!ReadIndexKey(Ar, Key, Dictionary)) return false;
+			Ar.SerializeIntPacked(Length);
+			Ar.SerializeIntPacked(Version);
+			if (Ar.IsError() || InOutOffset + Length > MAX_int32 || Version > MAX_int32) return false;
+
+			FSaveObjectRange Range;
+			Range.Offset = static_cast<int32>(InOutOffset);
+			Range.Length = static_cast<int32>(Length);
+			Range.Version = static_cast<int32>(Version);
+			Index.Add(Key, Range);
+			InOutOffset += Length;
+		}
+		return true;
+	}
+
+	void WriteNameTable(FArchive& Ar, const TArray<FName>& Names)
+	{
+		uint32 Num = Names.Num();
+		Ar.SerializeIntPacked(Num);
+		for (const FName& Name : Names)
+		{
+			FString Str = Name.ToString();
+			Ar << Str;
+		}
+	}
+
+	bool ReadNameTable(FArchive& Ar, TArray<FName>& OutNames)
+	{
+		uint32 Num = 0;
+		Ar.SerializeIntPacked(Num);
+		if (Ar.IsError() || Num > Ar.TotalSize() - Ar.Tell()) return false;
+
+		OutNames.Reserve(Num);
+		for (uint32 i = 0; i < Num && !Ar.IsError(); ++i)
+		{
+			FString Str;
+			Ar << Str;
+			OutNames.Emplace(*Str);
+		}
+		return !Ar.IsError();
+	}
+
+	/**
+	 * Body after the meta fields: the name dictionary, the object index (varint lengths and versions), then every
+	 * object's compact encoding back to back.
+	 * Decoded objects are encoded; still-encoded ones are copied through untouched (the dictionary is seeded with
+	 * theirs, so their indices stay valid). Versions live in the index, so a copied-through object keeps its own.
+	 */
+	void WriteBody(FArchive& Ar, FSaveSnapshot& Snapshot)
+	{
+		Ar << Snapshot.SaveVersion;
+		Ar << Snapshot.SaveTimestamp;
+		Ar << Snapshot.BuildId;
+		Ar << Snapshot.Sequence;
+
+		const FSaveObjectIndex& Undecoded = Snapshot.Undecoded;
+		check(Undecoded.IsEmpty() || Undecoded.Names.IsValid());
+
+		FSaveNameDictionary Dictionary;
+		if (!Undecoded.IsEmpty())
+		{
+			Dictionary.Append(*Undecoded.Names);
+		}
+
+		TArray<uint8> Payload;
+		FMemoryWriter PayloadAr(Payload, /*bIsPersistent*/true);
+		TArray<TPair<FName, FSaveObjectRange>> NamedIndex;
+		TArray<TPair<FGuid, FSaveObjectRange>> GuidIndex;
+		NamedIndex.Reserve(Snapshot.PlayerSave.ObjectData.Num() + Undecoded.Named.Num());
+		GuidIndex.Reserve(Snapshot.PlayerSave.GuidObjectData.Num() + Undecoded.Guids.Num());
+
+		auto Encode = [&PayloadAr, &Payload, &Dictionary](FSaveObjectData& Data)
+		{
+			FSaveObjectRange Range;
+			Range.Offset = Payload.Num();
+			Range.Version = Data.Version;
+			WriteObjectCompact(PayloadAr, Data, Dictionary);
+			Range.Length = Payload.Num() - Range.Offset;
+			return Range;
+		};
+		auto CopyThrough = [&PayloadAr, &Payload, &Undecoded](const FSaveObjectRange& Source)
+		{
+			FSaveObjectRange Range;
+			Range.Offset = Payload.Num();
+			Range.Version = Source.Version;
+			TConstArrayView<uint8> Bytes = Undecoded.GetBytes(Source);
+			PayloadAr.Serialize(const_cast<uint8*>(Bytes.GetData()), Bytes.Num());
+			Range.Length = Bytes.Num();
+			return Range;
+		};
+
+		for (TPair<FName, FSaveObjectData>& Pair : Snapshot.PlayerSave.ObjectData)
+		{
+			NamedIndex.Emplace(Pair.Key, Encode(Pair.Value));
+		}
+		for (const TPair<FName, FSaveObjectRange>& Pair : Undecoded.Named)
+		{
+			NamedIndex.Emplace(Pair.Key, CopyThrough(Pair.Value));
+		}
+		for (TPair<FGuid, FSaveObjectData>& Pair : Snapshot.PlayerSave.GuidObjectData)
+		{
+			GuidIndex.Emplace(Pair.Key, Encode(Pair.Value));
+		}
+		for (const TPair<FGuid, FSaveObjectRange>& Pair : Undecoded.Guids)
+		{
+			GuidIndex.Emplace(Pair.Key, CopyThrough(Pair.Value));
+		}
+
+		// Index keys go into the dictionary too, so it is complete only once the index has been encoded.
+		TArray<uint8> IndexBytes;
+		{
+			FMemoryWriter IndexAr(IndexBytes, /*bIsPersistent*/true);
+			WriteIndex(IndexAr, NamedIndex, Dictionary);
+			WriteIndex(IndexAr, GuidIndex, Dictionary);
+		}
+		WriteNameTable(Ar, Dictionary.GetNames());
+		Ar.Serialize(IndexBytes.GetData(), IndexBytes.Num());
+		Ar << Payload;
+	}
+
+	void ReadBody(FArchive& Ar, FSaveSnapshot& Snapshot)
+	{
+		Ar << Snapshot.SaveVersion;
+		Ar << Snapshot.SaveTimestamp;
+		Ar << Snapshot.BuildId;
+		Ar << Snapshot.Sequence;
+
+		// Only the index is decoded here; payload bytes stay encoded until an object is asked for.
+		FSaveObjectIndex& Index = Snapshot.Undecoded;
+		TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Payload = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+		TSharedRef<TArray<FName>, ESPMode::ThreadSafe> Names = MakeShared<TArray<FName>, ESPMode::ThreadSafe>();
+		int64 PayloadEnd = 0;
+		if (!ReadNameTable(Ar, *Names)
+			|| !ReadIndex(Ar, Index.Named, *Names, PayloadEnd)
+			|| !ReadIndex(Ar, Index.Guids, *Names, PayloadEnd))
+		{
+			Ar.SetError();
+			return;
+		}
+		Ar << *Payload;
+		if (Ar.IsError() || PayloadEnd > Payload->Num())
+		{
+			Ar.SetError();
+			return;
+		}
+		Index.Names = Names;
+		Index.Payload = Payload;
+	}
+}
+
+namespace SaveSlotFormat
+{
+	FName GetFormatName(ESaveCompressionCodec Codec)
+	{
+		switch (Codec)
+		{
+		case ESaveCompressionCodec::Zlib:  return NAME_Zlib;
+		case ESaveCompressionCodec::Gzip:  return NAME_Gzip;
+		case ESaveCompressionCodec::LZ4:   return NAME_LZ4;
+		case ESaveCompressionCodec::Oodle: return NAME_Oodle;
+		default:                           return NAME_None;
+		}
+	}
+
+	bool IsCodecAvailable(ESaveCompressionCodec Codec)
+	{
+		return Codec == ESaveCompressionCodec::None || FCompression::IsFormatValid(GetFormatName(Codec));
+	}
+
+	bool IsContainer(TConstArrayView<uint8> Bytes)
+	{
+		if (Bytes.Num() < static_cast<int32>(sizeof(uint32))) return false;
+
+		uint32 Found = 0;
+		FMemory::Memcpy(&Found, Bytes.GetData(), sizeof(uint32));
+		return Found == Magic;
+	}
+
+	bool Verify(TConstArrayView<uint8> Bytes)
+	{
+		if (!IsContainer(Bytes) || Bytes.Num() < static_cast<int32>(sizeof(uint32) + sizeof(int32))) return false;
+
+		int32 FormatVersion = 0;
+		FMemory::Memcpy(&FormatVersion, Bytes.GetData() + sizeof(uint32), sizeof(int32));
+		if (FormatVersion != CurrentFormatVersion || Bytes.Num() < CrcCoveredFrom) return false;
+
+		uint32 StoredCrc = 0;
+		FMemory::Memcpy(&StoredCrc, Bytes.GetData() + CrcOffset, sizeof(uint32));
+		return FCrc::MemCrc32(Bytes.GetData() + CrcCoveredFrom, Bytes.Num() - CrcCoveredFrom) == StoredCrc;
+	}
+
+	ESaveCompressionCodec GetCodec(TConstArrayView<uint8> Bytes)
+	{
+		if (!IsContainer(Bytes) || Bytes.Num() <= CrcCoveredFrom) return ESaveCompressionCodec::None;
+		return static_cast<ESaveCompressionCodec>(Bytes[CrcCoveredFrom]);
+	}
+
+	void Write(const FSaveSnapshot& Snapshot, TArray<uint8>& OutBytes, const FEncodeOptions& Options)
+	{
+		// Serialization is non-const by FArchive convention; saving only folds stray legacy fields.
+		FSaveSnapshot& Mutable = const_cast<FSaveSnapshot&>(Snapshot);
+
+		TArray<uint8> Body;
+		{
+			FMemoryWriter BodyAr(Body, /*bIsPersistent*/true);
+			WriteBody(BodyAr, Mutable);
+		}
+
+		uint8 Codec = static_cast<uint8>(ESaveCompressionCodec::None);
+		int32 RawSize = Body.Num();
+
+		TArray<uint8> Compressed;
+		const FName FormatName = GetFormatName(Options.Codec);
+		if (!FormatName.IsNone() && IsCodecAvailable(Options.Codec) && RawSize > 0)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, RawSize);
+			Compressed.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(FormatName, Compressed.GetData(), CompressedSize, Body.GetData(), RawSize,
+					ToCompressionFlags(Options.Level))
+				&& CompressedSize < RawSize)
+			{
+				Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+				Codec = static_cast<uint8>(Options.Codec);
+			}
+		}
+		const TArray<uint8>& Stored = Codec != static_cast<uint8>(ESaveCompressionCodec::None) ? Compressed : Body;
+
+		OutBytes.Reset(CrcCoveredFrom + sizeof(uint8) + sizeof(int32) + Stored.Num());
+		FMemoryWriter Ar(OutBytes, /*bIsPersistent*/true);
+
+		uint32 HeaderMagic = Magic;
+		int32 FormatVersion = CurrentFormatVersion;
+		uint32 Crc = 0; // patched below
+		Ar << HeaderMagic;
+		Ar << FormatVersion;
+		Ar << Crc;
+		Ar << Codec;
+		Ar << RawSize;
+		Ar.Serialize(const_cast<uint8*>(Stored.GetData()), Stored.Num());
+
+		Crc = FCrc::MemCrc32(OutBytes.GetData() + CrcCoveredFrom, OutBytes.Num() - CrcCoveredFrom);
+		FMemory::Memcpy(OutBytes.GetData() + CrcOffset, &Crc, sizeof(uint32));
+	}
+
+	bool Read(TConstArrayView<uint8> Bytes, FSaveSnapshot& OutSnapshot)
+	{
+		if (!Verify(Bytes)) return false;
+
+		FMemoryReaderView Ar(Bytes, /*bIsPersistent*/true);
+
+		// Magic, version and CRC were checked by Verify.
+		uint32 HeaderMagic = 0;
+		int32 FormatVersion = 0;
+		uint32 Crc = 0;
+		uint8 Codec = 0;
+		int32 RawSize = 0;
+		Ar << HeaderMagic;
+		Ar << FormatVersion;
+		Ar << Crc;
+		Ar << Codec;
+		Ar << RawSize;
+
+		const ESaveCompressionCodec CodecEnum = static_cast<ESaveCompressionCodec>(Codec);
+		if (CodecEnum != ESaveCompressionCodec::None)
+		{
+			if (Ar.IsError() || RawSize <= 0 || !IsCodecAvailable(CodecEnum))
+			{
+				return false;
+			}
+
+			const int64 Offset = Ar.Tell();
+			TArray<uint8> Raw;
+			Raw.SetNumUninitialized(RawSize);
+			if (!FCompression::UncompressMemory(GetFormatName(CodecEnum), Raw.GetData(), RawSize,
+					Bytes.GetData() + Offset, static_cast<int32>(Bytes.Num() - Offset)))
+			{
+				return false;
+			}
+
+			FMemoryReaderView RawAr(Raw, /*bIsPersistent*/true);
+			ReadBody(RawAr, OutSnapshot);
+			return !RawAr.IsError();
+		}
+
+		ReadBody(Ar, OutSnapshot);
+		return !Ar.IsError();
+	}
+}
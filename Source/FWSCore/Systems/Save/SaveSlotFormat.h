@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSystem.h"
+#include "SaveSlotFormat.generated.h"
+
+/** Compression applied to the container body. Values are stored in slot headers: append only. */
+UENUM(BlueprintType)
+enum class ESaveCompressionCodec : uint8
+{
+	None,
+	Zlib,
+	Gzip,
+	LZ4,
+	Oodle
+};
+
+/** Speed/size bias passed to the codec. */
+UENUM(BlueprintType)
+enum class ESaveCompressionLevel : uint8
+{
+	Fastest,
+	Balanced,
+	Smallest
+};
+
+/**
+ * Native FWS slot container.
+ * Unlike SaveGameToSlot (UObject serialization, game thread only) this works purely on
+ * FSaveSnapshot values, so encoding/decoding can run on any thread.
+ * Slots that don't start with the container magic are legacy USaveGame blobs.
+ */
+namespace SaveSlotFormat
+{
+	/** 'FWSS' */
+	constexpr uint32 Magic = 0x53535746;
+
+	/**
+	 * Bump when the layout changes (and keep a reader for every version that shipped); readers reject others.
+	 *  1: magic, version, CRC32 of everything after the CRC field, codec and uncompressed body size, then the
+	 *     (possibly compressed) body: meta fields and journal Sequence, per-image name dictionary, object index
+	 *     (varint lengths and per-object versions), and the objects in the compact row form, decoded lazily.
+	 */
+	constexpr int32 CurrentFormatVersion = 1;
+
+	/** Offset of the CRC field; the CRC covers every byte after it. */
+	constexpr int32 CrcOffset = sizeof(uint32) + sizeof(int32);
+	constexpr int32 CrcCoveredFrom = CrcOffset + sizeof(uint32);
+
+	/** How Write encodes the body. Readers pick the codec up from the header. */
+	struct FEncodeOptions
+	{
+		ESaveCompressionCodec Codec = ESaveCompressionCodec::None;
+		ESaveCompressionLevel Level = ESaveCompressionLevel::Balanced;
+	};
+
+	/** FCompression format name for a codec (NAME_None for None). */
+	FWSCORE_API FName GetFormatName(ESaveCompressionCodec Codec);
+
+	/** False if the codec isn't available in this build (e.g. Oodle plugin disabled). */
+	FWSCORE_API bool IsCodecAvailable(ESaveCompressionCodec Codec);
+
+	/** True if Bytes start with the container magic. */
+	FWSCORE_API bool IsContainer(TConstArrayView<uint8> Bytes);
+
+	/** Cheap integrity check (magic, version, body CRC) without decoding. */
+	FWSCORE_API bool Verify(TConstArrayView<uint8> Bytes);
+
+	/** Codec recorded in an image header (None for legacy images). */
+	FWSCORE_API ESaveCompressionCodec GetCodec(TConstArrayView<uint8> Bytes);
+
+	/**
+	 * Encodes a snapshot into a self-contained slot image. Thread-safe.
+	 * Falls back to an uncompressed body if the codec is unavailable or doesn't shrink the data.
+	 */
+	FWSCORE_API void Write(const FSaveSnapshot& Snapshot, TArray<uint8>& OutBytes, const FEncodeOptions& Options = FEncodeOptions());
+
+	/** Decodes a slot image's header and index; objects land in OutSnapshot.Undecoded. Returns false for legacy blobs, unknown versions, checksum mismatches or truncated data. Thread-safe. */
+	FWSCORE_API bool Read(TConstArrayView<uint8> Bytes, FSaveSnapshot& OutSnapshot);
+}
+
+/** Binary (non-tagged) serialization of one object's fields and payload, as journal records carry them. */
+FWSCORE_API FArchive& operator<<(FArchive& Ar, FSaveObjectData& Data);
@@ -0,0 +1,295 @@
+﻿#include "SaveSlotStorage.h"
+#include "FWSCore.h"
+#include "SaveSlotFormat.h"
+#include "SaveJournal.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	constexpr TCHAR ChunkSeparator = TEXT('@');
+
+	/** Legacy USaveGame blobs have no checksum; the container must verify. */
+	bool IsUsableImage(const TArray<uint8>& Bytes)
+	{
+		if (Bytes.Num() == 0) return false;
+		return !SaveSlotFormat::IsContainer(Bytes) || SaveSlotFormat::Verify(Bytes);
+	}
+
+	/** Slots are named per user already, so the platform save system always sees user 0. */
+	constexpr int32 PlatformUserIndex = 0;
+
+	ISaveGameSystem* GetPlatformSaveSystem()
+	{
+		return IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	}
+}
+
+namespace SaveSlotStorage
+{
+	FString GetSlotPath(const FString& Slot)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (Slot + TEXT(".sav"));
+	}
+
+	FString GetTempPath(const FString& Slot)
+	{
+		return GetSlotPath(Slot) + TEXT(".tmp");
+	}
+
+	FString GetGenerationPath(const FString& Slot, int32 Generation)
+	{
+		return FString::Printf(TEXT("%s.%d"), *GetSlotPath(Slot), Generation);
+	}
+
+	bool WriteAtomic(const FString& Slot, TConstArrayView<uint8> Bytes, int32 NumGenerations)
+	{
+		if (!UsesSlotFiles())
+		{
+			// The platform save system commits whole saves on its own terms; it has no rename or generations.
+			ISaveGameSystem* SaveSystem = GetPlatformSaveSystem();
+			const bool bOk = SaveSystem && SaveSystem->SaveGame(/*bAttemptToUseUI*/false, *Slot, PlatformUserIndex, TArray<uint8>(Bytes));
+			if (!bOk)
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotStorage] Platform save of %s failed."), *Slot);
+			}
+			return bOk;
+		}
+
+		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+		const FString Final = GetSlotPath(Slot);
+		const FString Temp  = GetTempPath(Slot);
+		NumGenerations = FMath::Clamp(NumGenerations, 0, MaxGenerations);
+
+		PF.CreateDirectoryTree(*FPaths::GetPath(Final));
+
+		// 1) Full image to the temp file, flushed to disk before anything is renamed.
+		{
+			TUniquePtr<IFileHandle> Handle(PF.OpenWrite(*Temp));
+			if (!Handle)
+			{
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotStorage] Could not open %s for write."), *Temp);
+				return false;
+			}
+			if (!Handle->Write(Bytes.GetData(), Bytes.Num()) || !Handle->Flush(/*bFullFlush*/true))
+			{
+				Handle.Reset();
+				PF.DeleteFile(*Temp);
+				UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotStorage] Write to %s failed."), *Temp);
+				return false;
+			}
+		}
+
+		// 2) Shift generations by rename: the oldest drops off, the current image becomes .1.
+		if (PF.FileExists(*Final))
+		{
+			if (NumGenerations > 0)
+			{
+				PF.DeleteFile(*GetGenerationPath(Slot, NumGenerations));
+				for (int32 Gen = NumGenerations - 1; Gen >= 1; --Gen)
+				{
+					const FString From = GetGenerationPath(Slot, Gen);
+					if (PF.FileExists(*From))
+					{
+						PF.MoveFile(*GetGenerationPath(Slot, Gen + 1), *From);
+					}
+				}
+				PF.MoveFile(*GetGenerationPath(Slot, 1), *Final);
+			}
+			else
+			{
+				// MoveFile doesn't replace an existing target on every platform.
+				PF.DeleteFile(*Final);
+			}
+		}
+
+		// 3) Publish. If we die before this, the verified temp file is picked up on load.
+		if (!PF.MoveFile(*Final, *Temp))
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotStorage] Could not move %s into place."), *Temp);
+			return false;
+		}
+		return true;
+	}
+
+	bool ReadNewestValid(const FString& Slot, TArray<uint8>& OutBytes, FString* OutSource)
+	{
+		if (!UsesSlotFiles())
+		{
+			ISaveGameSystem* SaveSystem = GetPlatformSaveSystem();
+			if (SaveSystem && SaveSystem->LoadGame(/*bAttemptToUseUI*/false, *Slot, PlatformUserIndex, OutBytes) && IsUsableImage(OutBytes))
+			{
+				if (OutSource) *OutSource = Slot;
+				return true;
+			}
+			OutBytes.Reset();
+			return false;
+		}
+
+		// Newest first: a leftover temp only exists if the last write died after flushing it.
+		TArray<FString, TInlineAllocator<MaxGenerations + 2>> Candidates;
+		Candidates.Add(GetTempPath(Slot));
+		Candidates.Add(GetSlotPath(Slot));
+		for (int32 Gen = 1; Gen <= MaxGenerations; ++Gen)
+		{
+			Candidates.Add(GetGenerationPath(Slot, Gen));
+		}
+
+		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+		for (int32 i = 0; i < Candidates.Num(); ++i)
+		{
+			const FString& Path = Candidates[i];
+			if (!PF.FileExists(*Path)) continue;
+
+			if (FFileHelper::LoadFileToArray(OutBytes, *Path, FILEREAD_Silent) && IsUsableImage(OutBytes)
+				&& (i != 0 || SaveSlotFormat::IsContainer(OutBytes)))
+			{
+				if (i > 1)
+				{
+					UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSlotStorage] %s: newest image damaged, recovered from %s."),
+						*Slot, *FPaths::GetCleanFilename(Path));
+				}
+				if (OutSource) *OutSource = Path;
+				return true;
+			}
+		}
+
+		OutBytes.Reset();
+		return false;
+	}
+
+	bool Exists(const FString& Slot)
+	{
+		if (!UsesSlotFiles())
+		{
+			ISaveGameSystem* SaveSystem = GetPlatformSaveSystem();
+			return SaveSystem && SaveSystem->DoesSaveGameExist(*Slot, PlatformUserIndex);
+		}
+
+		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+		if (PF.FileExists(*GetSlotPath(Slot)) || PF.FileExists(*GetTempPath(Slot)))
+		{
+			return true;
+		}
+		for (int32 Gen = 1; Gen <= MaxGenerations; ++Gen)
+		{
+			if (PF.FileExists(*GetGenerationPath(Slot, Gen))) return true;
+		}
+		return false;
+	}
+
+	int64 GetSize(const FString& Slot)
+	{
+		if (!UsesSlotFiles())
+		{
+			return 0; // not exposed without loading the save
+		}
+
+		IFileManager& FM = IFileManager::Get();
+		int64 ImageSize = FM.FileSize(*GetSlotPath(Slot));
+		if (ImageSize < 0)
+		{
+			ImageSize = FM.FileSize(*GetTempPath(Slot));
+		}
+		return FMath::Max<int64>(ImageSize, 0) + SaveJournal::GetSize(Slot);
+	}
+
+	void Delete(const FString& Slot)
+	{
+		if (!UsesSlotFiles())
+		{
+			if (ISaveGameSystem* SaveSystem = GetPlatformSaveSystem())
+			{
+				SaveSystem->DeleteGame(/*bAttemptToUseUI*/false, *Slot, PlatformUserIndex);
+			}
+		}
+		else
+		{
+			IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+			PF.DeleteFile(*GetSlotPath(Slot));
+			PF.DeleteFile(*GetTempPath(Slot));
+			for (int32 Gen = 1; Gen <= MaxGenerations; ++Gen)
+			{
+				PF.DeleteFile(*GetGenerationPath(Slot, Gen));
+			}
+			SaveJournal::Discard(Slot);
+		}
+
+		if (IsChunkSlot(Slot))
+		{
+			return;
+		}
+
+		TArray<FString> ChunkSlots;
+		FindChunkSlots(Slot, ChunkSlots);
+		for (const FString& ChunkSlot : ChunkSlots)
+		{
+			Delete(ChunkSlot);
+		}
+	}
+
+	void FindChunkSlots(const FString& Slot, TArray<FString>& OutChunkSlots)
+	{
+		if (!UsesSlotFiles())
+		{
+			TArray<FString> Names;
+			if (ISaveGameSystem* SaveSystem = GetPlatformSaveSystem())
+			{
+				SaveSystem->GetSaveGameNames(Names, PlatformUserIndex);
+			}
+			const FString Prefix = Slot + ChunkSeparator;
+			for (const FString& Name : Names)
+			{
+				if (Name.StartsWith(Prefix, ESearchCase::CaseSensitive))
+				{
+					OutChunkSlots.Add(Name);
+				}
+			}
+			return;
+		}
+
+		// Every file of every chunk ("<Slot>@<Partition>.sav", ".sav.N", ".sav.tmp", ".journal").
+		TArray<FString> ChunkFiles;
+		IFileManager::Get().FindFiles(ChunkFiles, *(FPaths::GetPath(GetSlotPath(Slot)) / (Slot + ChunkSeparator + TEXT("*"))), true, false);
+
+		// Profile names may contain dots, the partition key never does: the extension starts at the first dot after it.
+		TSet<FString> ChunkSlots;
+		for (const FString& File : ChunkFiles)
+		{
+			const int32 Dot = File.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, Slot.Len() + 1);
+			ChunkSlots.Add(Dot == INDEX_NONE ? File : File.Left(Dot));
+		}
+		OutChunkSlots.Append(ChunkSlots.Array());
+	}
+
+	FString GetChunkSlot(const FString& Slot, FName Partition)
+	{
+		// "/Game/Maps/Forest" -> "Game_Maps_Forest": keeps the chunk a single dot-free file name.
+		FString Key = Partition.ToString();
+		Key.RemoveFromStart(TEXT("/"));
+		for (TCHAR& Ch : Key)
+		{
+			if (!FChar::IsAlnum(Ch) && Ch != TEXT('-'))
+			{
+				Ch = TEXT('_');
+			}
+		}
+		return Slot + ChunkSeparator + Key;
+	}
+
+	bool IsChunkSlot(const FString& Slot)
+	{
+		int32 Index = INDEX_NONE;
+		return Slot.FindChar(ChunkSeparator, Index);
+	}
+
+	FString GetProfileSlot(const FString& Slot)
+	{
+		int32 Index = INDEX_NONE;
+		return Slot.FindChar(ChunkSeparator, Index) ? Slot.Left(Index) : Slot;
+	}
+}
@@ -0,0 +1,64 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * True where the platform's ISaveGameSystem is the generic file-backed one (desktop), so slots can be handled as
+ * files directly. Elsewhere (consoles) every image goes through ISaveGameSystem::SaveGame/LoadGame/DeleteGame and
+ * there are no temp files, backup generations or journals: each save writes a full image. Define it in the
+ * module's Build.cs to override.
+ */
+#ifndef FWS_SAVE_SLOT_FILES
+#define FWS_SAVE_SLOT_FILES PLATFORM_DESKTOP
+#endif
+
+/**
+ * Crash-safe slot files under Saved/SaveGames (same layout the generic ISaveGameSystem uses for "<Slot>.sav").
+ * Writes go to "<Slot>.sav.tmp", are flushed, then renamed into place; previous images shift to
+ * "<Slot>.sav.1" .. ".N" by rename, so backups cost no extra serialization or I/O.
+ * Reads pick the newest generation whose container checksum verifies.
+ * Without FWS_SAVE_SLOT_FILES the same calls map onto the platform ISaveGameSystem (see UsesSlotFiles).
+ * Callers serialize access per slot via SaveJournal::GetSlotLock(Slot).
+ */
+namespace SaveSlotStorage
+{
+	/** False when slots live in a platform save system: no generations, no journal (always full images). */
+	constexpr bool UsesSlotFiles() { return FWS_SAVE_SLOT_FILES != 0; }
+
+	FWSCORE_API FString GetSlotPath(const FString& Slot);
+	FWSCORE_API FString GetTempPath(const FString& Slot);
+	FWSCORE_API FString GetGenerationPath(const FString& Slot, int32 Generation);
+
+	/** Writes Bytes atomically, keeping up to NumGenerations older images. */
+	FWSCORE_API bool WriteAtomic(const FString& Slot, TConstArrayView<uint8> Bytes, int32 NumGenerations);
+
+	/** Loads the newest intact image (temp, current, then generations 1..N). OutSource names the file used. */
+	FWSCORE_API bool ReadNewestValid(const FString& Slot, TArray<uint8>& OutBytes, FString* OutSource = nullptr);
+
+	/** True if any image (current, temp or generation) exists for the slot. */
+	FWSCORE_API bool Exists(const FString& Slot);
+
+	/** Bytes on disk for the current image (or the temp file if it is missing) plus the journal. 0 in a platform save system. */
+	FWSCORE_API int64 GetSize(const FString& Slot);
+
+	/** Removes the slot, its generations, temp file and journal, plus the slot's partition chunks. */
+	FWSCORE_API void Delete(const FString& Slot);
+
+	/**
+	 * Slot holding one save partition (streamed level / World Partition cell) of a profile: "<Slot>@<Partition>".
+	 * SanitizeSlotName never produces the separator, so chunk slots can't collide with profiles.
+	 */
+	FWSCORE_API FString GetChunkSlot(const FString& Slot, FName Partition);
+
+	/** Appends the chunk slots of Slot that have any file on disk. */
+	FWSCORE_API void FindChunkSlots(const FString& Slot, TArray<FString>& OutChunkSlots);
+
+	/** True for names produced by GetChunkSlot. */
+	FWSCORE_API bool IsChunkSlot(const FString& Slot);
+
+	/** Profile slot a chunk slot belongs to; any other slot is its own. */
+	FWSCORE_API FString GetProfileSlot(const FString& Slot);
+
+	/** Highest generation index probed by Exists/ReadNewestValid/Delete. */
+	constexpr int32 MaxGenerations = 9;
+}
@@ -0,0 +1,165 @@
+﻿#include "SaveStats.h"
+#include "FWSCore.h"
+#include "SaveSystemSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+void FSaveStatsHistory::SetCapacity(int32 InCapacity)
+{
+	Capacity = FMath::Max(1, InCapacity);
+
+	// Back to oldest-first, keeping the newest ones, so the ring starts over at the end.
+	TArray<FSaveStats> Ordered;
+	Ordered.Reserve(Records.Num());
+	for (int32 i = 0; i < Records.Num(); ++i)
+	{
+		Ordered.Add(MoveTemp(Records[(Next + i) % Records.Num()]));
+	}
+	const int32 Keep = FMath::Min(Ordered.Num(), Capacity);
+	Records = TArray<FSaveStats>(Ordered.GetData() + Ordered.Num() - Keep, Keep);
+	Next = 0;
+}
+
+void FSaveStatsHistory::Add(const FSaveStats& Stats)
+{
+	if (Records.Num() < Capacity)
+	{
+		Records.Add(Stats);
+		return;
+	}
+	Records[Next] = Stats;
+	Next = (Next + 1) % Capacity;
+}
+
+void FSaveStatsHistory::Reset()
+{
+	Records.Reset();
+	Next = 0;
+}
+
+float FSaveStatsHistory::Percentile(FField Field, float P) const
+{
+	if (Records.Num() == 0)
+	{
+		return 0.f;
+	}
+
+	TArray<float> Values;
+	Values.Reserve(Records.Num());
+	for (const FSaveStats& Stats : Records)
+	{
+		Values.Add(Field(Stats));
+	}
+	Values.Sort();
+
+	const int32 Rank = FMath::CeilToInt(FMath::Clamp(P, 0.f, 100.f) / 100.f * Values.Num());
+	return Values[FMath::Clamp(Rank - 1, 0, Values.Num() - 1)];
+}
+
+void FSaveStatsHistory::Histogram(FField Field, int32 NumBuckets, TArray<int32>& OutCounts) const
+{
+	OutCounts.Init(0, FMath::Max(1, NumBuckets));
+	for (const FSaveStats& Stats : Records)
+	{
+		const float Ms = Field(Stats);
+		const int32 Bucket = Ms < 1.f ? 0 : 1 + FMath::FloorLog2(static_cast<uint32>(Ms));
+		++OutCounts[FMath::Min(Bucket, OutCounts.Num() - 1)];
+	}
+}
+
+FSaveStatsSummary FSaveStatsHistory::Summarize() const
+{
+	FSaveStatsSummary Summary;
+	Summary.Count = Records.Num();
+	if (Summary.Count == 0)
+	{
+		return Summary;
+	}
+
+	const auto Total = [](const FSaveStats& S) { return S.GetTotalMs(); };
+	Summary.P50TotalMs     = Percentile(Total, 50.f);
+	Summary.P95TotalMs     = Percentile(Total, 95.f);
+	Summary.MaxTotalMs     = Percentile(Total, 100.f);
+	Summary.P95MaxFrameMs  = Percentile([](const FSaveStats& S) { return S.MaxFrameMs; }, 95.f);
+	Summary.P95QueueWaitMs = Percentile([](const FSaveStats& S) { return S.QueueWaitMs; }, 95.f);
+
+	int64 Bytes = 0;
+	for (const FSaveStats& Stats : Records)
+	{
+		Bytes += Stats.Bytes;
+	}
+	Summary.AverageBytes = Bytes / Summary.Count;
+
+	const int32 Newest = Records.Num() < Capacity ? Records.Num() - 1 : (Next + Capacity - 1) % Capacity;
+	Summary.SlotObjectCount = Records[Newest].SlotObjectCount;
+	return Summary;
+}
+
+void FSaveStatsHistory::Log(const TCHAR* Label) const
+{
+	const FSaveStatsSummary Summary = Summarize();
+	UE_LOG(LogSaveSystem, Display, TEXT("[SaveStats] %s: %d recent, total p50=%.2fms p95=%.2fms max=%.2fms, frame p95=%.2fms, queue p95=%.2fms, avg %lld bytes, %d objects in slot"),
+		Label, Summary.Count, Summary.P50TotalMs, Summary.P95TotalMs, Summary.MaxTotalMs, Summary.P95MaxFrameMs,
+		Summary.P95QueueWaitMs, Summary.AverageBytes, Summary.SlotObjectCount);
+	if (Summary.Count == 0)
+	{
+		return;
+	}
+
+	struct FPhase
+	{
+		const TCHAR* Name;
+		float (*Get)(const FSaveStats&);
+	};
+	static const FPhase Phases[] = {
+		{ TEXT("gather"),    [](const FSaveStats& S) { return S.GatherMs; } },
+		{ TEXT("serialize"), [](const FSaveStats& S) { return S.SerializeMs; } },
+		{ TEXT("io"),        [](const FSaveStats& S) { return S.WriteMs; } },
+		{ TEXT("queue"),     [](const FSaveStats& S) { return S.QueueWaitMs; } },
+		{ TEXT("frame"),     [](const FSaveStats& S) { return S.MaxFrameMs; } },
+	};
+
+	// <1, <2, <4, ... <512, >=512 ms
+	constexpr int32 NumBuckets = 11;
+	for (const FPhase& Phase : Phases)
+	{
+		TArray<int32> Counts;
+		Histogram(Phase.Get, NumBuckets, Counts);
+
+		FString Line;
+		for (int32 i = 0; i < Counts.Num(); ++i)
+		{
+			const FString Bound = i + 1 < Counts.Num() ? FString::Printf(TEXT("<%d"), 1 << i) : FString::Printf(TEXT(">=%d"), 1 << (i - 1));
+			Line += FString::Printf(TEXT(" %s:%d"), *Bound, Counts[i]);
+		}
+		UE_LOG(LogSaveSystem, Display, TEXT("[SaveStats]   %-9s ms%s"), Phase.Name, *Line);
+	}
+}
+
+namespace
+{
+	void DumpSaveStats(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		USaveSystemSubsystem* SaveSub = GI ? GI->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+		if (!SaveSub)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveStats] No SaveSystemSubsystem in this world."));
+			return;
+		}
+
+		if (Args.Contains(TEXT("Reset")))
+		{
+			SaveSub->ResetStatsHistory();
+			return;
+		}
+		SaveSub->GetStatsHistory(ESaveStatsOp::Save).Log(TEXT("Saves"));
+		SaveSub->GetStatsHistory(ESaveStatsOp::Load).Log(TEXT("Loads"));
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs GSaveStatsCmd(
+		TEXT("FWS.Save.Stats"),
+		TEXT("FWS.Save.Stats [Reset] - percentiles and per-phase histograms of the recent saves and loads."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DumpSaveStats));
+}
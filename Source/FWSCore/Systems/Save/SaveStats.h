@@ -0,0 +1,158 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveStats.generated.h"
+
+UENUM(BlueprintType)
+enum class ESaveStatsOp : uint8
+{
+	Save,
+	Load
+};
+
+/**
+ * Cost of one save or load of one profile, reported through USaveSystemSubsystem::OnSaveStats when it completes.
+ * Game-thread and worker parts are kept apart so a growing save shows where the time goes.
+ */
+USTRUCT(BlueprintType)
+struct FWSCORE_API FSaveStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	ESaveStatsOp Op = ESaveStatsOp::Save;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	FString SlotName;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 LocalUserNum = 0;
+
+	/** False for failed writes and for loads cancelled by a newer load or profile switch. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	bool bSuccess = false;
+
+	/** Save: the profile slot got a full image rather than a journal record. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	bool bFullImage = false;
+
+	/** Game thread, summed over frames. Save: SaveData calls + dirty snapshot. Load: payload resolve + LoadData calls. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float GatherMs = 0.f;
+
+	/** Save: encoding images and journal records (compaction included). Load: decoding images and replaying journals. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float SerializeMs = 0.f;
+
+	/** Save: file writes and backup rotation. Load: file reads. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float WriteMs = 0.f;
+
+	/** Time the worker part waited behind earlier writes of the same profile (or, synchronous, the game thread did). */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float QueueWaitMs = 0.f;
+
+	/** Longest single game-thread frame of the operation. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float MaxFrameMs = 0.f;
+
+	/** Frames the game-thread part was spread over. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 Frames = 0;
+
+	/** Bytes written (images, records, compaction) or read. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int64 Bytes = 0;
+
+	/** Registered objects gathered or fed. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 ObjectCount = 0;
+
+	/** Save: changed payloads and removals the write carried, chunk slots included. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 DirtyCount = 0;
+
+	/** Payloads in the profile's save object afterwards; grows with playtime. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 SlotObjectCount = 0;
+
+	/** Seconds since the application started, to plot cost against session length. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float SessionSeconds = 0.f;
+
+	/** Work time of the operation, without queue wait. */
+	float GetTotalMs() const { return GatherMs + SerializeMs + WriteMs; }
+};
+
+/** Percentiles of the recent saves or loads (see FSaveStatsHistory). */
+USTRUCT(BlueprintType)
+struct FWSCORE_API FSaveStatsSummary
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 Count = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float P50TotalMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float P95TotalMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float MaxTotalMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float P95MaxFrameMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	float P95QueueWaitMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int64 AverageBytes = 0;
+
+	/** Of the newest record. */
+	UPROPERTY(BlueprintReadOnly, Category="Save System|Stats")
+	int32 SlotObjectCount = 0;
+};
+
+/** Worker-side part of a save or load, summed over the slots it touched. Filled by whichever thread did the work. */
+struct FSaveIoTimings
+{
+	double SerializeSeconds = 0.0;
+	double IoSeconds = 0.0;
+	/** Blocked on the slot I/O lock (another thread's read or write of the profile). */
+	double LockWaitSeconds = 0.0;
+	int64 Bytes = 0;
+};
+
+/** Rolling window of the most recent records of one kind, with percentile and histogram queries. Game thread only. */
+class FWSCORE_API FSaveStatsHistory
+{
+public:
+	using FField = TFunctionRef<float(const FSaveStats&)>;
+
+	/** Oldest records drop out once Capacity are held. */
+	void SetCapacity(int32 InCapacity);
+	void Add(const FSaveStats& Stats);
+	void Reset();
+
+	int32 Num() const { return Records.Num(); }
+
+	/** P in [0, 100] of Field over the window (nearest rank); 0 when empty. */
+	float Percentile(FField Field, float P) const;
+
+	/** Counts per power-of-two millisecond bucket: [0,1), [1,2), [2,4), ... the last one open-ended. */
+	void Histogram(FField Field, int32 NumBuckets, TArray<int32>& OutCounts) const;
+
+	FSaveStatsSummary Summarize() const;
+
+	/** Logs the summary and per-phase histograms under Label. */
+	void Log(const TCHAR* Label) const;
+
+private:
+	/** Ring buffer; Next is the slot the next record goes to once it is full. */
+	TArray<FSaveStats> Records;
+	int32 Next = 0;
+	int32 Capacity = 256;
+};
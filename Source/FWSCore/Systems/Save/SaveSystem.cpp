@@ -2,8 +2,42 @@
 #include "FWSCore.h"
 #include "Saveable.h"
 #include "SaveIdComponent.h"
+#include "SaveIdRegistry.h"
+#include "SaveMigration.h"
+#include "SaveReadSnapshot.h"
+#include "SaveSlotFormat.h"
 #include "GameFramework/Actor.h"
 #include "Misc/DefaultValueHelper.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Class.h"
+
+void USaveSystem::Serialize(FArchive& Ar)
+{
+	// UObject serialization (SaveGameToMemory etc.) only sees PlayerSave, so decode what's still indexed.
+	if (Ar.IsSaving() && (Ar.IsPersistent() || Ar.IsSaveGame()))
+	{
+		MaterializeAll();
+	}
+
+	Super::Serialize(Ar);
+
+	// Slots written before typed fields only carry SavedFields; fold them in once.
+	// They predate per-object versions too, so every payload is as old as the slot.
+	if (Ar.IsLoading())
+	{
+		PlayerSave.UpgradeLegacyFields();
+		for (TPair<FName, FSaveObjectData>& Pair : PlayerSave.ObjectData)
+		{
+			Pair.Value.Version = Pair.Value.Version ? Pair.Value.Version : SaveVersion;
+		}
+		for (TPair<FGuid, FSaveObjectData>& Pair : PlayerSave.GuidObjectData)
+		{
+			Pair.Value.Version = Pair.Value.Version ? Pair.Value.Version : SaveVersion;
+		}
+	}
+}
 
 void USaveSystem::SaveAllData(TArray<UObject*> SaveableObjects)
 {
@@ -12,153 +46,695 @@ void USaveSystem::SaveAllData(TArray<UObject*> SaveableObjects)
 
 	for (UObject* Obj : SaveableObjects)
 	{
-		if (!IsValid(Obj)) continue;
+		SaveObject(Obj);
+	}
+}
 
-		if (ISaveable* Saveable = Cast<ISaveable>(Obj))
-		{
-			ISaveable::Execute_SaveData(Obj, this);
-			UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveSystem] Saved: %s"), *Obj->GetName());
-		}
-		else
-		{
-			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystem] %s does not implement ISaveable."), *Obj->GetName());
-		}
+void USaveSystem::SaveObject(UObject* Obj)
+{
+	if (!IsValid(Obj)) return;
+
+	// Implements<> rather than Cast<ISaveable>: Blueprint-only implementers have no native interface pointer.
+	if (Obj->Implements<USaveable>())
+	{
+		TGuardValue<const UClass*> ClassScope(MigrationClass, Obj->GetClass());
+		FSaveableDispatch::SaveData(Obj, this);
+		UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveSystem] Saved: %s"), *Obj->GetName());
+	}
+	else
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystem] %s does not implement ISaveable."), *Obj->GetName());
 	}
 }
 
 void USaveSystem::LoadAllData(TArray<UObject*> LoadableObjects)
 {
+	TArray<FSaveableRef> Refs;
+	Refs.Reserve(LoadableObjects.Num());
 	for (UObject* Obj : LoadableObjects)
 	{
+		if (IsValid(Obj))
+		{
+			Refs.Add(FSaveableRef::Make(Obj));
+		}
+	}
+
+	FSaveLoadBatch Batch;
+	ResolveLoadBatch(Refs, Batch);
+	DispatchLoadBatch(Batch, 0.0);
+}
+
+FSaveableRef FSaveableRef::Make(UObject* Obj)
+{
+	FSaveableRef Ref;
+	Ref.Object = Obj;
+	if (const AActor* AsActor = Cast<AActor>(Obj))
+	{
+		// Registered components are indexed by the world; only actors outside a world need the component search.
+		const USaveIdRegistry* Registry = USaveIdRegistry::Get(AsActor);
+		Ref.SaveId = Registry ? Registry->FindComponent(AsActor) : AsActor->FindComponentByClass<USaveIdComponent>();
+	}
+	return Ref;
+}
+
+void USaveSystem::GetSavedGuids(TArray<FGuid>& OutGuids) const
+{
+	OutGuids.Reset(PlayerSave.GuidObjectData.Num() + Undecoded.Guids.Num());
+	for (const TPair<FGuid, FSaveObjectData>& Pair : PlayerSave.GuidObjectData)
+	{
+		OutGuids.Add(Pair.Key);
+	}
+	for (const TPair<FGuid, FSaveObjectRange>& Pair : Undecoded.Guids)
+	{
+		OutGuids.Add(Pair.Key);
+	}
+}
+
+const FSaveObjectData* USaveSystem::PeekObjectByGuid(const FGuid& Guid, FSaveObjectData& Scratch) const
+{
+	if (const FSaveObjectData* Decoded = PlayerSave.GuidObjectData.Find(Guid))
+	{
+		return Decoded;
+	}
+	const FSaveObjectRange* Range = Undecoded.Guids.Find(Guid);
+	return Range && Undecoded.Decode(*Range, Scratch) ? &Scratch : nullptr;
+}
+
+int64 USaveSystem::GetEncodedSize(const FGuid& Guid) const
+{
+	if (const FSaveObjectRange* Range = Undecoded.Guids.Find(Guid))
+	{
+		return Range->Length;
+	}
+	const FSaveObjectData* Decoded = PlayerSave.GuidObjectData.Find(Guid);
+	if (!Decoded) return 0;
+
+	FSaveObjectData Copy = *Decoded;
+	TArray<uint8> Bytes;
+	FMemoryWriter Ar(Bytes);
+	Ar << Copy;
+	return Bytes.Num();
+}
+
+const FSaveObjectData* USaveSystem::FindPayloadFor(const UObject* Obj, const USaveIdComponent* SaveId) const
+{
+	const FSaveObjectData* Found = nullptr;
+	TGuardValue<const UClass*> ClassScope(MigrationClass, Obj ? Obj->GetClass() : nullptr);
+
+	// Prefer GUID lookup if it's an Actor with a SaveIdComponent
+	if (SaveId && SaveId->HasGuid())
+	{
+		Found = FindObjectByGuid(SaveId->SaveGuid);
+	}
+
+	// Fallback to legacy name-keyed lookup (your previous behavior)
+	if (!Found && Obj)
+	{
+		Found = FindObject(Obj->GetFName());
+	}
+	return Found;
+}
+
+void USaveSystem::ResolveLoadBatch(TConstArrayView<FSaveableRef> Refs, FSaveLoadBatch& OutBatch) const
+{
+	OutBatch.Reset();
+	OutBatch.Items.Reserve(Refs.Num());
+
+	for (const FSaveableRef& Ref : Refs)
+	{
+		UObject* Obj = Ref.Object.Get();
 		if (!IsValid(Obj)) continue;
 
-		if (ISaveable* Saveable = Cast<ISaveable>(Obj))
+		if (!Obj->Implements<USaveable>())
 		{
-			const FSaveObjectData* Found = nullptr;
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystem] %s does not implement ISaveable."), *Obj->GetName());
+			continue;
+		}
 
-			// Prefer GUID lookup if it's an Actor with a SaveIdComponent
-			if (const AActor* AsActor = Cast<AActor>(Obj))
-			{
-				if (const USaveIdComponent* Idc = AsActor->FindComponentByClass<USaveIdComponent>())
-				{
-					if (Idc->HasGuid())
-					{
-						Found = FindObjectByGuid(Idc->SaveGuid);
-					}
-				}
-			}
+		FSaveLoadBatch::FItem& Item = OutBatch.Items.AddDefaulted_GetRef();
+		Item.Ref = Ref;
+		Item.Payload = FindPayloadFor(Obj, Ref.SaveId.Get());
+	}
 
-			// Fallback to legacy name-keyed lookup (your previous behavior)
-			if (!Found)
+	// Lazy decodes above may have grown PlayerSave; stamp the version after them.
+	OutBatch.StructureVersion = StructureVersion;
+}
+
+bool USaveSystem::DispatchLoadBatch(FSaveLoadBatch& Batch, double BudgetSeconds)
+{
+	const double Deadline = BudgetSeconds > 0.0 ? FPlatformTime::Seconds() + BudgetSeconds : 0.0;
+	const FSaveObjectData Empty;
+
+	while (!Batch.IsDone())
+	{
+		// Something (a save, a LoadData implementation) moved PlayerSave storage: refresh the remaining pointers.
+		if (Batch.StructureVersion != StructureVersion)
+		{
+			for (int32 i = Batch.Cursor; i < Batch.Items.Num(); ++i)
 			{
-				const FName DefaultId = Obj->GetFName();
-				Found = FindObject(DefaultId);
+				FSaveLoadBatch::FItem& Item = Batch.Items[i];
+				Item.Payload = FindPayloadFor(Item.Ref.Object.Get(), Item.Ref.SaveId.Get());
 			}
+			Batch.StructureVersion = StructureVersion;
+		}
 
-			FSaveObjectData Empty;
-			const FSaveObjectData& Payload = Found ? *Found : Empty;
-			 ISaveable::Execute_LoadData(Obj, this, Payload);
+		const FSaveLoadBatch::FItem& Item = Batch.Items[Batch.Cursor++];
+		if (UObject* Obj = Item.Ref.Object.Get(); IsValid(Obj))
+		{
+			TGuardValue<const UClass*> ClassScope(MigrationClass, Obj->GetClass());
+			FSaveableDispatch::LoadData(Obj, this, Item.Payload ? *Item.Payload : Empty);
 
 			UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveSystem] Loaded: %s (HasData=%s)"),
-				*Obj->GetName(), Found ? TEXT("true") : TEXT("false"));
+				*Obj->GetName(), Item.Payload ? TEXT("true") : TEXT("false"));
 		}
-		else
+
+		if (Deadline > 0.0 && FPlatformTime::Seconds() >= Deadline)
 		{
-			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystem] %s does not implement ISaveable."), *Obj->GetName());
+			break;
+		}
+	}
+	return Batch.IsDone();
+}
+
+FSaveSnapshot USaveSystem::MakeSnapshot() const
+{
+	FSaveSnapshot Snapshot;
+	Snapshot.PlayerSave    = PlayerSave;
+	Snapshot.SaveVersion   = SaveVersion;
+	Snapshot.SaveTimestamp = SaveTimestamp;
+	Snapshot.BuildId       = BuildId;
+	Snapshot.Sequence      = SaveSequence;
+	Snapshot.Undecoded     = Undecoded;
+	return Snapshot;
+}
+
+void USaveSystem::ApplySnapshot(FSaveSnapshot&& Snapshot)
+{
+	PlayerSave    = MoveTemp(Snapshot.PlayerSave);
+	SaveVersion   = Snapshot.SaveVersion;
+	SaveTimestamp = Snapshot.SaveTimestamp;
+	BuildId       = MoveTemp(Snapshot.BuildId);
+	SaveSequence  = Snapshot.Sequence;
+	Undecoded     = MoveTemp(Snapshot.Undecoded);
+	PlayerSave.UpgradeLegacyFields();
+
+	// Room for every lazily decoded object, so decoding on Find never moves existing entries.
+	PlayerSave.ObjectData.Reserve(PlayerSave.ObjectData.Num() + Undecoded.Named.Num());
+	PlayerSave.GuidObjectData.Reserve(PlayerSave.GuidObjectData.Num() + Undecoded.Guids.Num());
+	++StructureVersion;
+	++SnapshotEpoch;
+	ClearDirtyState();
+	bNeedsFullWrite = false;
+}
+
+FSaveDelta USaveSystem::MakeDelta()
+{
+	FSaveDelta Delta;
+	Delta.SaveVersion   = SaveVersion;
+	Delta.SaveTimestamp = SaveTimestamp;
+	Delta.BuildId       = BuildId;
+
+	// Flag scan is cheap; only dirty payloads are copied and later encoded/written.
+	for (TPair<FName, FSaveObjectData>& Pair : PlayerSave.ObjectData)
+	{
+		if (Pair.Value.IsDirty())
+		{
+			Pair.Value.ClearDirty();
+			Delta.ObjectUpserts.Add(Pair.Key, Pair.Value);
+		}
+	}
+	for (TPair<FGuid, FSaveObjectData>& Pair : PlayerSave.GuidObjectData)
+	{
+		if (Pair.Value.IsDirty())
+		{
+			Pair.Value.ClearDirty();
+			Delta.GuidUpserts.Add(Pair.Key, Pair.Value);
+		}
+	}
+	Delta.ObjectRemovals = PendingObjectRemovals.Array();
+	Delta.GuidRemovals   = PendingGuidRemovals.Array();
+	PendingObjectRemovals.Reset();
+	PendingGuidRemovals.Reset();
+
+	if (!Delta.IsEmpty())
+	{
+		Delta.Sequence = ++SaveSequence;
+	}
+	return Delta;
+}
+
+int32 USaveSystem::ClearDirtyState()
+{
+	int32 NumCleared = PendingObjectRemovals.Num() + PendingGuidRemovals.Num();
+	for (TPair<FName, FSaveObjectData>& Pair : PlayerSave.ObjectData)
+	{
+		NumCleared += Pair.Value.IsDirty() ? 1 : 0;
+		Pair.Value.ClearDirty();
+	}
+	for (TPair<FGuid, FSaveObjectData>& Pair : PlayerSave.GuidObjectData)
+	{
+		NumCleared += Pair.Value.IsDirty() ? 1 : 0;
+		Pair.Value.ClearDirty();
+	}
+	PendingObjectRemovals.Reset();
+	PendingGuidRemovals.Reset();
+	return NumCleared;
+}
+
+bool USaveSystem::HasUnsavedChanges() const
+{
+	if (PendingObjectRemovals.Num() > 0 || PendingGuidRemovals.Num() > 0) return true;
+	if (bNeedsFullWrite && (PlayerSave.ObjectData.Num() > 0 || PlayerSave.GuidObjectData.Num() > 0 || !Undecoded.IsEmpty())) return true;
+
+	for (const TPair<FName, FSaveObjectData>& Pair : PlayerSave.ObjectData)
+	{
+		if (Pair.Value.IsDirty()) return true;
+	}
+	for (const TPair<FGuid, FSaveObjectData>& Pair : PlayerSave.GuidObjectData)
+	{
+		if (Pair.Value.IsDirty()) return true;
+	}
+	return false;
+}
+
+namespace
+{
+	/** Copy-on-write per payload: clean ones that Previous already holds are shared, everything else is copied once. */
+	template <typename KeyType>
+	void ShareOrCopy(const TMap<KeyType, FSaveObjectData>& Source, const TMap<KeyType, FSaveReadSnapshot::FObjectPtr>* Previous,
+		TMap<KeyType, FSaveReadSnapshot::FObjectPtr>& Out)
+	{
+		Out.Reserve(Source.Num());
+		for (const TPair<KeyType, FSaveObjectData>& Pair : Source)
+		{
+			const FSaveReadSnapshot::FObjectPtr* Shared = Previous && !Pair.Value.IsDirty() ? Previous->Find(Pair.Key) : nullptr;
+			Out.Add(Pair.Key, Shared ? *Shared : MakeShared<const FSaveObjectData, ESPMode::ThreadSafe>(Pair.Value));
 		}
 	}
 }
 
+TSharedRef<const FSaveReadSnapshot, ESPMode::ThreadSafe> USaveSystem::MakeReadSnapshot(const FSaveReadSnapshot* Previous) const
+{
+	TSharedRef<FSaveReadSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FSaveReadSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->SaveVersion   = SaveVersion;
+	Snapshot->SaveTimestamp = SaveTimestamp;
+	Snapshot->Sequence      = SaveSequence;
+	Snapshot->Source        = FObjectKey(this);
+	Snapshot->Epoch         = SnapshotEpoch;
+
+	// A payload that isn't dirty hasn't changed since Previous was taken only if nothing cleared flags in between
+	// without a snapshot (the subsystem publishes before every write) and the state wasn't swapped out.
+	if (Previous && (Previous->Source != Snapshot->Source || Previous->Epoch != SnapshotEpoch))
+	{
+		Previous = nullptr;
+	}
+	ShareOrCopy(PlayerSave.ObjectData, Previous ? &Previous->Named : nullptr, Snapshot->Named);
+	ShareOrCopy(PlayerSave.GuidObjectData, Previous ? &Previous->Guids : nullptr, Snapshot->Guids);
+
+	// The index only ever loses entries (decodes, removals) within an epoch, so same buffer + same size is the same index.
+	if (!Undecoded.IsEmpty())
+	{
+		const FSaveObjectIndex* PreviousIndex = Previous ? Previous->Undecoded.Get() : nullptr;
+		Snapshot->Undecoded = PreviousIndex && PreviousIndex->Payload == Undecoded.Payload && PreviousIndex->Num() == Undecoded.Num()
+			? Previous->Undecoded
+			: MakeShared<const FSaveObjectIndex, ESPMode::ThreadSafe>(Undecoded);
+	}
+	return Snapshot;
+}
+
+void USaveSystem::MaterializeAll()
+{
+	if (!Undecoded.IsEmpty())
+	{
+		Undecoded.DecodeAllInto(PlayerSave);
+		++StructureVersion;
+	}
+
+	// No saveable is at hand here, so only id and catch-all steps can run (see MigrateOnAccess).
+	for (TPair<FName, FSaveObjectData>& Pair : PlayerSave.ObjectData)
+	{
+		MigrateOnAccess(Pair.Value, Pair.Key, /*bForWrite*/false);
+	}
+	for (TPair<FGuid, FSaveObjectData>& Pair : PlayerSave.GuidObjectData)
+	{
+		MigrateOnAccess(Pair.Value, NAME_None, /*bForWrite*/false);
+	}
+}
+
+void USaveSystem::MigrateOnAccess(FSaveObjectData& Data, FName ObjectId, bool bForWrite) const
+{
+	if (Data.Version >= SaveVersion) return;
+
+	const FSaveMigrationRegistry& Registry = FSaveMigrationRegistry::Get();
+
+	// A GUID payload only knows its class through the saveable it's resolved for. Read without one,
+	// leave it old so the class steps still run once FindPayloadFor/SaveData reaches it.
+	if (ObjectId.IsNone() && !MigrationClass && !bForWrite && Registry.HasClassSteps(Data.Version, SaveVersion))
+	{
+		return;
+	}
+
+	if (Registry.Migrate(Data, SaveVersion, ObjectId, MigrationClass))
+	{
+		Data.MarkDirty();
+	}
+}
+
+void FSaveDelta::ApplyTo(FSaveSnapshot& Snapshot) const
+{
+	// Upserts carry whole objects, so any still-encoded copy is simply superseded.
+	for (const TPair<FName, FSaveObjectData>& Pair : ObjectUpserts)
+	{
+		Snapshot.Undecoded.Named.Remove(Pair.Key);
+		Snapshot.PlayerSave.ObjectData.Add(Pair.Key, Pair.Value);
+	}
+	for (const TPair<FGuid, FSaveObjectData>& Pair : GuidUpserts)
+	{
+		Snapshot.Undecoded.Guids.Remove(Pair.Key);
+		Snapshot.PlayerSave.GuidObjectData.Add(Pair.Key, Pair.Value);
+	}
+	for (const FName& Id : ObjectRemovals)
+	{
+		Snapshot.Undecoded.Named.Remove(Id);
+		Snapshot.PlayerSave.ObjectData.Remove(Id);
+	}
+	for (const FGuid& Guid : GuidRemovals)
+	{
+		Snapshot.Undecoded.Guids.Remove(Guid);
+		Snapshot.PlayerSave.GuidObjectData.Remove(Guid);
+	}
+
+	Snapshot.SaveVersion   = SaveVersion;
+	Snapshot.SaveTimestamp = SaveTimestamp;
+	Snapshot.BuildId       = BuildId;
+	Snapshot.Sequence      = FMath::Max(Snapshot.Sequence, Sequence);
+}
+
 /* ---------- Helpers ---------- */
 
+template <typename KeyType>
+FSaveObjectData& USaveSystem::AddTracked(TMap<KeyType, FSaveObjectData>& Map, const KeyType& Key, FSaveObjectData&& Data) const
+{
+	const SIZE_T AllocatedBefore = Map.GetAllocatedSize();
+	FSaveObjectData& Added = Map.Add(Key, MoveTemp(Data));
+	if (Map.GetAllocatedSize() != AllocatedBefore)
+	{
+		++StructureVersion;
+	}
+	return Added;
+}
+
 const FSaveObjectData* USaveSystem::FindObject(FName ObjectId) const
 {
-	if (const FSaveObjectData* Ptr = PlayerSave.ObjectData.Find(ObjectId))
+	FSaveObjectData* Found = const_cast<USaveSystem*>(this)->PlayerSave.ObjectData.Find(ObjectId);
+
+	// First access to an object from an index-first slot: decode it now. Decoding (and migrating) doesn't
+	// change the logical contents, so this stays const from the caller's point of view.
+	FSaveObjectData Decoded;
+	if (!Found && Undecoded.Take(ObjectId, Decoded))
 	{
-		return Ptr;
+		Found = &AddTracked(const_cast<USaveSystem*>(this)->PlayerSave.ObjectData, ObjectId, MoveTemp(Decoded));
 	}
-	return nullptr;
+	if (Found)
+	{
+		MigrateOnAccess(*Found, ObjectId, /*bForWrite*/false);
+	}
+	return Found;
 }
 
 FSaveObjectData& USaveSystem::GetOrCreateObject(FName ObjectId)
 {
-	return PlayerSave.ObjectData.FindOrAdd(ObjectId);
+	if (FSaveObjectData* Existing = const_cast<FSaveObjectData*>(FindObject(ObjectId)))
+	{
+		return *Existing;
+	}
+	PendingObjectRemovals.Remove(ObjectId);
+	Undecoded.Named.Remove(ObjectId); // an entry that failed to decode is superseded
+	FSaveObjectData& Created = AddTracked(PlayerSave.ObjectData, ObjectId, FSaveObjectData());
+	Created.Version = SaveVersion;
+	Created.MarkDirty();
+	return Created;
 }
 
 const FSaveObjectData* USaveSystem::FindObjectByGuid(const FGuid& Guid) const
 {
-	if (const FSaveObjectData* Ptr = PlayerSave.GuidObjectData.Find(Guid))
+	FSaveObjectData* Found = const_cast<USaveSystem*>(this)->PlayerSave.GuidObjectData.Find(Guid);
+
+	FSaveObjectData Decoded;
+	if (!Found && Undecoded.Take(Guid, Decoded))
 	{
-		return Ptr;
+		Found = &AddTracked(const_cast<USaveSystem*>(this)->PlayerSave.GuidObjectData, Guid, MoveTemp(Decoded));
 	}
-	return nullptr;
+	if (Found)
+	{
+		MigrateOnAccess(*Found, NAME_None, /*bForWrite*/false);
+	}
+	return Found;
 }
 
 FSaveObjectData& USaveSystem::GetOrCreateObjectByGuid(const FGuid& Guid)
 {
-	return PlayerSave.GuidObjectData.FindOrAdd(Guid);
+	if (FSaveObjectData* Existing = const_cast<FSaveObjectData*>(FindObjectByGuid(Guid)))
+	{
+		// About to be written: whatever layout the writer assumes, the payload must not stay behind.
+		MigrateOnAccess(*Existing, NAME_None, /*bForWrite*/true);
+		return *Existing;
+	}
+	PendingGuidRemovals.Remove(Guid);
+	Undecoded.Guids.Remove(Guid); // an entry that failed to decode is superseded
+	FSaveObjectData& Created = AddTracked(PlayerSave.GuidObjectData, Guid, FSaveObjectData());
+	Created.Version = SaveVersion;
+	Created.MarkDirty();
+	return Created;
+}
+
+bool USaveSystem::RemoveObject(FName ObjectId)
+{
+	const bool bRemoved = PlayerSave.ObjectData.Remove(ObjectId) > 0;
+	if (!bRemoved && Undecoded.Named.Remove(ObjectId) == 0) return false;
+	++StructureVersion;
+	PendingObjectRemovals.Add(ObjectId);
+	return true;
+}
+
+bool USaveSystem::RemoveObjectByGuid(const FGuid& Guid)
+{
+	const bool bRemoved = PlayerSave.GuidObjectData.Remove(Guid) > 0;
+	if (!bRemoved && Undecoded.Guids.Remove(Guid) == 0) return false;
+	++StructureVersion;
+	PendingGuidRemovals.Add(Guid);
+	return true;
 }
 
 void USaveSystem::SetField(FName ObjectId, FName Key, const FString& Value)
 {
-	GetOrCreateObject(ObjectId).SavedFields.Add(Key, Value);
+	GetOrCreateObject(ObjectId).SetField(Key, Value);
 }
 
 bool USaveSystem::GetField(FName ObjectId, FName Key, FString& OutValue) const
 {
-	if (const FSaveObjectData* Obj = FindObject(ObjectId))
-	{
-		if (const FString* Found = Obj->SavedFields.Find(Key))
-		{
-			OutValue = *Found;
-			return true;
-		}
-	}
-	return false;
+	const FSaveObjectData* Obj = FindObject(ObjectId);
+	return Obj && Obj->GetField(Key, OutValue);
 }
 
 void USaveSystem::SetInt(FName ObjectId, FName Key, int32 Value)
 {
-	SetField(ObjectId, Key, LexToString(Value));
+	GetOrCreateObject(ObjectId).SetInt(Key, Value);
 }
 
 bool USaveSystem::GetInt(FName ObjectId, FName Key, int32& Out) const
 {
-	FString S;
-	if (GetField(ObjectId, Key, S))
-	{
-		return FDefaultValueHelper::ParseInt(S, Out);
-	}
-	return false;
+	const FSaveObjectData* Obj = FindObject(ObjectId);
+	return Obj && Obj->GetInt(Key, Out);
 }
 
 void USaveSystem::SetFloat(FName ObjectId, FName Key, float Value)
 {
-	SetField(ObjectId, Key, LexToString(Value));
+	GetOrCreateObject(ObjectId).SetFloat(Key, Value);
 }
 
 bool USaveSystem::GetFloat(FName ObjectId, FName Key, float& Out) const
 {
-	FString S;
-	if (GetField(ObjectId, Key, S))
+	const FSaveObjectData* Obj = FindObject(ObjectId);
+	return Obj && Obj->GetFloat(Key, Out);
+}
+
+void USaveSystem::SetBool(FName ObjectId, FName Key, bool bValue)
+{
+	GetOrCreateObject(ObjectId).SetBool(Key, bValue);
+}
+
+bool USaveSystem::GetBool(FName ObjectId, FName Key, bool& Out) const
+{
+	const FSaveObjectData* Obj = FindObject(ObjectId);
+	return Obj && Obj->GetBool(Key, Out);
+}
+
+void USaveSystem::SetName(FName ObjectId, FName Key, FName Value)
+{
+	GetOrCreateObject(ObjectId).SetName(Key, Value);
+}
+
+bool USaveSystem::GetName(FName ObjectId, FName Key, FName& Out) const
+{
+	const FSaveObjectData* Obj = FindObject(ObjectId);
+	return Obj && Obj->GetName(Key, Out);
+}
+
+/* ---------- FSaveObjectData ---------- */
+
+bool FSaveObjectData::GetField(FName Key, FString& OutValue) const
+{
+	if (Fields.GetAsString(Key, OutValue))
+	{
+		return true;
+	}
+	if (const FString* Legacy = SavedFields.Find(Key))
 	{
-		return FDefaultValueHelper::ParseFloat(S, Out);
+		OutValue = *Legacy;
+		return true;
 	}
 	return false;
 }
 
-void USaveSystem::SetBool(FName ObjectId, FName Key, bool bValue)
+bool FSaveObjectData::GetInt(FName Key, int32& Out) const
+{
+	int64 Wide = 0;
+	if (!GetInt64(Key, Wide)) return false;
+	if (Wide < MIN_int32 || Wide > MAX_int32)
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystem] Field %s holds %lld, which doesn't fit in int32; read it with GetInt64."),
+			*Key.ToString(), Wide);
+		return false;
+	}
+	Out = static_cast<int32>(Wide);
+	return true;
+}
+
+bool FSaveObjectData::GetInt64(FName Key, int64& Out) const
 {
-	SetField(ObjectId, Key, bValue ? TEXT("1") : TEXT("0"));
+	if (Fields.GetInt(Key, Out)) return true;
+	const FString* Legacy = SavedFields.Find(Key);
+	return Legacy && FDefaultValueHelper::ParseInt64(*Legacy, Out);
 }
 
-bool USaveSystem::GetBool(FName ObjectId, FName Key, bool& Out) const
+bool FSaveObjectData::GetFloat(FName Key, float& Out) const
 {
-	FString S;
-	if (GetField(ObjectId, Key, S))
+	if (Fields.GetFloat(Key, Out)) return true;
+	const FString* Legacy = SavedFields.Find(Key);
+	return Legacy && FDefaultValueHelper::ParseFloat(*Legacy, Out);
+}
+
+bool FSaveObjectData::GetBool(FName Key, bool& Out) const
+{
+	if (Fields.GetBool(Key, Out)) return true;
+	if (const FString* Legacy = SavedFields.Find(Key))
 	{
-		Out = (S == TEXT("1") || S.Equals(TEXT("true"), ESearchCase::IgnoreCase));
+		Out = (*Legacy == TEXT("1") || Legacy->Equals(TEXT("true"), ESearchCase::IgnoreCase));
 		return true;
 	}
 	return false;
 }
+
+bool FSaveObjectData::GetName(FName Key, FName& Out) const
+{
+	if (Fields.GetName(Key, Out)) return true;
+	if (const FString* Legacy = SavedFields.Find(Key))
+	{
+		Out = FName(**Legacy);
+		return true;
+	}
+	return false;
+}
+
+namespace
+{
+	/** 'FWST': BinaryPayload holds a WriteStruct encoding. */
+	constexpr uint32 StructPayloadMagic = 0x54535746;
+}
+
+void FSaveObjectData::WriteStruct(const UScriptStruct* Struct, const void* Value)
+{
+	check(Struct && Value);
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes, /*bIsPersistent*/true);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, /*bInLoadIfFindFails*/false);
+
+	// Property tags are read back against the versions they were written with.
+	uint32 Magic = StructPayloadMagic;
+	int32 FileVersionUE4 = Ar.UEVer().FileVersionUE4;
+	int32 FileVersionUE5 = Ar.UEVer().FileVersionUE5;
+	int32 LicenseeVersion = Ar.LicenseeUEVer();
+	Ar << Magic;
+	Ar << FileVersionUE4;
+	Ar << FileVersionUE5;
+	Ar << LicenseeVersion;
+	const_cast<UScriptStruct*>(Struct)->SerializeItem(Ar, const_cast<void*>(Value), /*Defaults*/nullptr);
+
+	if (Bytes != BinaryPayload)
+	{
+		BinaryPayload = MoveTemp(Bytes);
+		bDirty = true;
+	}
+}
+
+bool FSaveObjectData::ReadStruct(const UScriptStruct* Struct, void* OutValue) const
+{
+	check(Struct && OutValue);
+	if (BinaryPayload.Num() == 0) return false;
+
+	FMemoryReader Reader(BinaryPayload, /*bIsPersistent*/true);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, /*bInLoadIfFindFails*/false);
+
+	uint32 Magic = 0;
+	int32 FileVersionUE4 = 0;
+	int32 FileVersionUE5 = 0;
+	int32 LicenseeVersion = 0;
+	Ar << Magic;
+	Ar << FileVersionUE4;
+	Ar << FileVersionUE5;
+	Ar << LicenseeVersion;
+	if (Ar.IsError() || Magic != StructPayloadMagic)
+	{
+		return false;
+	}
+
+	// Tags from a newer engine may use a layout this build can't parse.
+	const FPackageFileVersion PayloadVersion(FileVersionUE4, static_cast<EUnrealEngineObjectUE5Version>(FileVersionUE5));
+	if (FileVersionUE4 > GPackageFileUEVersion.FileVersionUE4 || FileVersionUE5 > GPackageFileUEVersion.FileVersionUE5)
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystem] %s payload was written by a newer engine; ignored."), *Struct->GetName());
+		return false;
+	}
+	Ar.SetUEVer(PayloadVersion);
+	Ar.SetLicenseeUEVer(LicenseeVersion);
+
+	const_cast<UScriptStruct*>(Struct)->SerializeItem(Ar, OutValue, /*Defaults*/nullptr);
+	return !Ar.IsError();
+}
+
+void FSaveObjectData::UpgradeLegacyFields()
+{
+	for (const TPair<FName, FString>& Pair : SavedFields)
+	{
+		// Typed entries win; the legacy map only fills gaps.
+		if (!Fields.Contains(Pair.Key))
+		{
+			Fields.SetFromLegacyText(Pair.Key, Pair.Value);
+		}
+	}
+	SavedFields.Empty();
+}
+
+void FPlayerSaveData::UpgradeLegacyFields()
+{
+	for (TPair<FName, FSaveObjectData>& Pair : ObjectData)
+	{
+		Pair.Value.UpgradeLegacyFields();
+	}
+	for (TPair<FGuid, FSaveObjectData>& Pair : GuidObjectData)
+	{
+		Pair.Value.UpgradeLegacyFields();
+	}
+}
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/SaveGame.h"
+#include "SaveFieldStore.h"
+#include <atomic>
 #include "SaveSystem.generated.h"
 
 /** Per-object payload. */
@@ -10,13 +12,83 @@ struct FSaveObjectData
 {
 	GENERATED_BODY()
 
-	/** String map keeps things simple & BP-friendly; use helpers to set/get typed values. */
+	/** Typed field columns; use the helpers below rather than touching this directly. */
+	UPROPERTY()
+	FSaveFieldStore Fields;
+
+	/** Legacy string map from older slots. Read as a fallback; folded into Fields on load. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TMap<FName, FString> SavedFields;
 
-	/** Optional binary payload for compact C++ serialization if you need it later */
+	/** Binary payload for compact C++ serialization (see WriteStruct/ReadStruct) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TArray<uint8> BinaryPayload;
+
+	/** SaveVersion whose layout this payload follows; older payloads migrate on first access (FSaveMigrationRegistry). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Version = 0;
+
+	/** ---- Field helpers (typed access never formats/parses text; changes mark the object dirty) ---- */
+
+	void SetField(FName Key, const FString& Value) { bDirty |= Fields.SetString(Key, Value); }
+	bool GetField(FName Key, FString& OutValue) const;
+
+	void SetInt(FName Key, int32 Value) { bDirty |= Fields.SetInt(Key, Value); }
+
+	/** False (Out untouched) if the stored value doesn't fit in int32; use GetInt64 for those. */
+	bool GetInt(FName Key, int32& Out) const;
+
+	void SetInt64(FName Key, int64 Value) { bDirty |= Fields.SetInt(Key, Value); }
+	bool GetInt64(FName Key, int64& Out) const;
+
+	void SetFloat(FName Key, float Value) { bDirty |= Fields.SetFloat(Key, Value); }
+	bool GetFloat(FName Key, float& Out) const;
+
+	void SetBool(FName Key, bool bValue) { bDirty |= Fields.SetBool(Key, bValue); }
+	bool GetBool(FName Key, bool& Out) const;
+
+	void SetName(FName Key, FName Value) { bDirty |= Fields.SetName(Key, Value); }
+	bool GetName(FName Key, FName& Out) const;
+
+	void SetBlob(FName Key, TArray<uint8> Value) { bDirty |= Fields.SetBlob(Key, MoveTemp(Value)); }
+	const TArray<uint8>* GetBlob(FName Key) const { return Fields.GetBlob(Key); }
+
+	bool RemoveField(FName Key) { const bool bRemoved = Fields.Remove(Key); bDirty |= bRemoved; return bRemoved; }
+
+	bool HasField(FName Key) const { return Fields.Contains(Key) || SavedFields.Contains(Key); }
+
+	/** Moves any legacy SavedFields entries into the typed store (numbers typed when lossless, else strings). */
+	void UpgradeLegacyFields();
+
+	/**
+	 * ---- Struct payload ----
+	 * Any USTRUCT as tagged binary properties in BinaryPayload: properties added or removed since the
+	 * payload was written are tolerated (missing ones keep OutValue's current value). Object references
+	 * are stored as paths and are not loaded if missing.
+	 */
+
+	template <typename T>
+	void WriteStruct(const T& Value) { WriteStruct(T::StaticStruct(), &Value); }
+
+	template <typename T>
+	bool ReadStruct(T& OutValue) const { return ReadStruct(T::StaticStruct(), &OutValue); }
+
+	/** Marks the object dirty only if the encoded bytes changed. */
+	void WriteStruct(const UScriptStruct* Struct, const void* Value);
+
+	/** False if there is no struct payload, or it was written by a newer engine version. */
+	bool ReadStruct(const UScriptStruct* Struct, void* OutValue) const;
+
+	/** ---- Dirty tracking (drives incremental journal saves) ---- */
+
+	/** Call after editing Fields/BinaryPayload directly instead of through the helpers. */
+	void MarkDirty() { bDirty = true; }
+	bool IsDirty() const { return bDirty; }
+	void ClearDirty() { bDirty = false; }
+
+private:
+	/** Changed since the last save that captured it. Not persisted. */
+	bool bDirty = false;
 };
 
 /** Per-player container of object payloads */
@@ -32,6 +104,144 @@ struct FPlayerSaveData
 	/** New: GUID-keyed data for stable identities */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TMap<FGuid, FSaveObjectData> GuidObjectData;
+
+	/** Folds legacy string fields of every object into typed storage. */
+	void UpgradeLegacyFields();
+};
+
+/** Byte range of one encoded FSaveObjectData inside FSaveObjectIndex::Payload. */
+struct FSaveObjectRange
+{
+	int32 Offset = 0;
+	int32 Length = 0;
+
+	/** FSaveObjectData::Version of the encoded object (kept in the index, so copied-through objects keep theirs). */
+	int32 Version = 0;
+};
+
+/**
+ * Objects of an index-first slot image that haven't been decoded yet.
+ * The payload buffer is immutable and shared, so snapshots copy only the index and
+ * untouched objects are written back byte-for-byte without ever being decoded.
+ */
+struct FWSCORE_API FSaveObjectIndex
+{
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Payload;
+	TMap<FName, FSaveObjectRange> Named;
+	TMap<FGuid, FSaveObjectRange> Guids;
+
+	/** Name dictionary the payload was encoded against; set whenever the index is non-empty. */
+	TSharedPtr<const TArray<FName>, ESPMode::ThreadSafe> Names;
+
+	int32 Num() const { return Named.Num() + Guids.Num(); }
+	bool IsEmpty() const { return Num() == 0; }
+	void Reset() { Payload.Reset(); Named.Reset(); Guids.Reset(); Names.Reset(); }
+
+	TConstArrayView<uint8> GetBytes(const FSaveObjectRange& Range) const;
+
+	/** Decodes one range in whichever encoding the payload uses. */
+	bool Decode(const FSaveObjectRange& Range, FSaveObjectData& Out) const;
+
+	/** Decodes one entry and drops it from the index. False if it isn't indexed or fails to decode (it then stays indexed). */
+	bool Take(FName ObjectId, FSaveObjectData& Out);
+	bool Take(const FGuid& Guid, FSaveObjectData& Out);
+
+	/**
+	 * Decodes every remaining entry into Target (entries already in Target win) and drops it from the index.
+	 * Entries that fail to decode are logged and stay indexed, so the next image still carries their bytes.
+	 */
+	void DecodeAllInto(FPlayerSaveData& Target);
+};
+
+/**
+ * Plain value copy of a USaveSystem's persistent state.
+ * Taken on the game thread after the gather; owned by whichever thread encodes/writes it.
+ */
+struct FSaveSnapshot
+{
+	FPlayerSaveData PlayerSave;
+	int32 SaveVersion = 1;
+	FDateTime SaveTimestamp;
+	FString BuildId;
+
+	/** Highest journal sequence folded into this image; later journal records apply on top. */
+	int64 Sequence = 0;
+
+	/** Objects still in encoded form. Never shares a key with PlayerSave. */
+	FSaveObjectIndex Undecoded;
+};
+
+/**
+ * Changes since the previous save: whole objects that went dirty plus removals.
+ * Appended to the slot journal instead of rewriting the full image.
+ */
+struct FSaveDelta
+{
+	int64 Sequence = 0;
+	int32 SaveVersion = 1;
+	FDateTime SaveTimestamp;
+	FString BuildId;
+
+	TMap<FName, FSaveObjectData> ObjectUpserts;
+	TMap<FGuid, FSaveObjectData> GuidUpserts;
+	TArray<FName> ObjectRemovals;
+	TArray<FGuid> GuidRemovals;
+
+	bool IsEmpty() const
+	{
+		return ObjectUpserts.Num() == 0 && GuidUpserts.Num() == 0 && ObjectRemovals.Num() == 0 && GuidRemovals.Num() == 0;
+	}
+
+	int32 NumChanges() const
+	{
+		return ObjectUpserts.Num() + GuidUpserts.Num() + ObjectRemovals.Num() + GuidRemovals.Num();
+	}
+
+	/** Replays this delta over a full image (idempotent; only call when Sequence > Snapshot.Sequence). */
+	void ApplyTo(FSaveSnapshot& Snapshot) const;
+};
+
+class USaveIdComponent;
+class FSaveReadSnapshot;
+
+/**
+ * Outcome of a save object's slot writes as the workers see it, shared with every write job taken from it.
+ * Read on the game thread before the next job is prepared, so it doesn't wait for the queued acknowledgement.
+ */
+struct FSaveWriteState
+{
+	/** A write of the slot failed and no full image has been written since: a journal record appended now would follow a gap. */
+	std::atomic<bool> bJournalBroken { false };
+};
+
+/** A saveable object with its USaveIdComponent looked up once (at registration) instead of per load. */
+struct FWSCORE_API FSaveableRef
+{
+	TWeakObjectPtr<UObject> Object;
+	TWeakObjectPtr<const USaveIdComponent> SaveId;
+
+	static FSaveableRef Make(UObject* Obj);
+};
+
+/**
+ * Saveables resolved to their payloads in one pass, then fed to ISaveable::LoadData in slices.
+ * Payload pointers are only valid while USaveSystem::GetStructureVersion() still equals StructureVersion;
+ * DispatchLoadBatch re-resolves the remainder when it doesn't.
+ */
+struct FSaveLoadBatch
+{
+	struct FItem
+	{
+		FSaveableRef Ref;
+		const FSaveObjectData* Payload = nullptr; // null = nothing saved for this object
+	};
+
+	TArray<FItem> Items;
+	int32 Cursor = 0;
+	uint32 StructureVersion = 0;
+
+	bool IsDone() const { return Cursor >= Items.Num(); }
+	void Reset() { Items.Reset(); Cursor = 0; }
 };
 
 /** Root save-game object (per-player) */
@@ -45,7 +255,7 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category="Save Data")
 	FPlayerSaveData PlayerSave;
 
-	/** Save metadata */
+	/** Save metadata. Payloads older than this migrate when first looked up; the subsystem sets it to CurrentSaveVersion on load. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Save Metadata")
 	int32 SaveVersion = 1;
 
@@ -57,6 +267,8 @@ public:
 	FString BuildId;
 
 public:
+	virtual void Serialize(FArchive& Ar) override;
+
 	/** Entry points used by the subsystem */
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	virtual void SaveAllData(TArray<UObject*> SaveableObjects);
@@ -64,9 +276,87 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save System")
 	virtual void LoadAllData(TArray<UObject*> LoadableObjects);
 
+	/** One object's SaveData; SaveAllData's per-object step, also used by the subsystem's time-sliced gather. */
+	void SaveObject(UObject* Obj);
+
+	/** Copies the persistent state so it can be encoded off the game thread. */
+	FSaveSnapshot MakeSnapshot() const;
+
+	/** Replaces the persistent state with a decoded snapshot. */
+	void ApplySnapshot(FSaveSnapshot&& Snapshot);
+
+	/** Copies dirty objects + pending removals into a new journal delta and clears the dirty state. */
+	FSaveDelta MakeDelta();
+
+	/** Forget dirty flags/removals (after a full image that already contains them was taken). Returns how many there were. */
+	int32 ClearDirtyState();
+
+	/** Dirty objects, pending removals, or changes a failed write left in memory only (bNeedsFullWrite). */
+	bool HasUnsavedChanges() const;
+
+	/**
+	 * Immutable copy of the current state for readers on other threads (FSaveReadSnapshot). Payloads that aren't dirty
+	 * are shared with Previous when it was taken from this object, so take one before dirty flags are cleared.
+	 */
+	TSharedRef<const FSaveReadSnapshot, ESPMode::ThreadSafe> MakeReadSnapshot(const FSaveReadSnapshot* Previous) const;
+
+	/** Journal sequence of the last captured change; persisted as FSaveSnapshot::Sequence. */
+	int64 SaveSequence = 0;
+
+	/** True until a full FWS image of this object is known to be on disk (fresh/legacy slots, failed deltas). */
+	bool bNeedsFullWrite = true;
+
+	/** Worker-side write outcome (see FSaveWriteState); a new object's slot starts intact. */
+	TSharedRef<FSaveWriteState, ESPMode::ThreadSafe> WriteState = MakeShared<FSaveWriteState, ESPMode::ThreadSafe>();
+
+	/**
+	 * Slots load index-first: objects are decoded (and migrated) into PlayerSave on first Find/GetOrCreate.
+	 * Call this before iterating PlayerSave directly (e.g. from Blueprint).
+	 */
+	UFUNCTION(BlueprintCallable, Category="Save System")
+	void MaterializeAll();
+
+	/** Objects present in the loaded slot that nothing has asked for yet. */
+	int32 GetNumUndecodedObjects() const { return Undecoded.Num(); }
+
+	/** Payloads held, decoded or not. */
+	int32 GetNumObjects() const { return PlayerSave.ObjectData.Num() + PlayerSave.GuidObjectData.Num() + Undecoded.Num(); }
+
+	/** Keys of every GUID payload, decoded or not (decodes nothing). */
+	void GetSavedGuids(TArray<FGuid>& OutGuids) const;
+
+	/** True if there is a GUID payload, decoded or not (decodes nothing). */
+	bool ContainsGuid(const FGuid& Guid) const { return PlayerSave.GuidObjectData.Contains(Guid) || Undecoded.Guids.Contains(Guid); }
+
+	/**
+	 * A GUID payload for a scan over the whole slot: undecoded ones are decoded into Scratch (not into PlayerSave)
+	 * and neither is migrated. Null if there is none.
+	 */
+	const FSaveObjectData* PeekObjectByGuid(const FGuid& Guid, FSaveObjectData& Scratch) const;
+
+	/** Bytes a GUID payload takes in the slot: its encoded range if undecoded, else its encoding now. 0 if there is none. */
+	int64 GetEncodedSize(const FGuid& Guid) const;
+
+	/** ---- Batched loading ---- */
+
+	/** Payload for one object: its SaveId GUID first, then its object name. SaveId may be null. */
+	const FSaveObjectData* FindPayloadFor(const UObject* Obj, const USaveIdComponent* SaveId) const;
+
+	/** Pass 1: resolves every object's payload (lookups + lazy decodes) in one go. */
+	void ResolveLoadBatch(TConstArrayView<FSaveableRef> Refs, FSaveLoadBatch& OutBatch) const;
+
+	/** Pass 2: calls LoadData for the next items until BudgetSeconds is used up (<= 0: no limit). True when finished. */
+	bool DispatchLoadBatch(FSaveLoadBatch& Batch, double BudgetSeconds);
+
+	/** Bumped whenever PlayerSave storage may have moved (inserts that reallocate, removals, snapshot swaps). */
+	uint32 GetStructureVersion() const { return StructureVersion; }
+
 	/** ---- Convenience helpers (C++ & BP) ---- */
 
-	/** Name-keyed (legacy) */
+	/**
+	 * Name-keyed (legacy)
+	 * Find may decode the object on first access; PlayerSave is pre-reserved for that, so earlier pointers stay valid.
+	 */
 	const FSaveObjectData* FindObject(FName ObjectId) const;
 	FSaveObjectData& GetOrCreateObject(FName ObjectId);
 
@@ -74,6 +364,10 @@ public:
 	const FSaveObjectData* FindObjectByGuid(const FGuid& Guid) const;
 	FSaveObjectData& GetOrCreateObjectByGuid(const FGuid& Guid);
 
+	/** Removes an object's payload; the removal is journaled on the next save. */
+	bool RemoveObject(FName ObjectId);
+	bool RemoveObjectByGuid(const FGuid& Guid);
+
 	/** Set/Get one field (BP-friendly, name-keyed) */
 	UFUNCTION(BlueprintCallable, Category="Save System|Edit")
 	void SetField(FName ObjectId, FName Key, const FString& Value);
@@ -81,7 +375,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Save System|Edit")
 	bool GetField(FName ObjectId, FName Key, FString& OutValue) const;
 
-	/** Typed helpers (stored as strings) */
+	/** Typed helpers (stored in typed columns; legacy string values are parsed on read) */
 	void SetInt(FName ObjectId, FName Key, int32 Value);
 	bool GetInt(FName ObjectId, FName Key, int32& Out) const;
 
@@ -90,4 +384,45 @@ public:
 
 	void SetBool(FName ObjectId, FName Key, bool bValue);
 	bool GetBool(FName ObjectId, FName Key, bool& Out) const;
+
+	void SetName(FName ObjectId, FName Key, FName Value);
+	bool GetName(FName ObjectId, FName Key, FName& Out) const;
+
+	/** Struct payload of an object (FSaveObjectData::WriteStruct / ReadStruct) */
+	template <typename T>
+	void SetStruct(FName ObjectId, const T& Value) { GetOrCreateObject(ObjectId).WriteStruct(Value); }
+
+	template <typename T>
+	bool GetStruct(FName ObjectId, T& OutValue) const
+	{
+		const FSaveObjectData* Obj = FindObject(ObjectId);
+		return Obj && Obj->ReadStruct(OutValue);
+	}
+
+private:
+	/** Not-yet-decoded objects of the loaded slot; mutable because first access from a const Find decodes. */
+	mutable FSaveObjectIndex Undecoded;
+
+	/** See GetStructureVersion(). */
+	mutable uint32 StructureVersion = 0;
+
+	/** Bumped when the state is replaced wholesale (ApplySnapshot), so read snapshots never share payloads across it. */
+	uint32 SnapshotEpoch = 0;
+
+	/**
+	 * Runs the migration steps a payload older than SaveVersion still needs; marks it dirty if any changed it.
+	 * GUID payloads read without a saveable class (outside Load/SaveData) wait for one while class steps are pending.
+	 */
+	void MigrateOnAccess(FSaveObjectData& Data, FName ObjectId, bool bForWrite) const;
+
+	/** Class of the saveable whose SaveData/LoadData is running, for class-keyed migration steps. */
+	mutable const UClass* MigrationClass = nullptr;
+
+	/** Map insert that bumps StructureVersion if existing entries may have moved. */
+	template <typename KeyType>
+	FSaveObjectData& AddTracked(TMap<KeyType, FSaveObjectData>& Map, const KeyType& Key, FSaveObjectData&& Data) const;
+
+	/** Removed since the last captured delta. */
+	TSet<FName> PendingObjectRemovals;
+	TSet<FGuid> PendingGuidRemovals;
 };
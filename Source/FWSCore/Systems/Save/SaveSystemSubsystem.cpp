@@ -1,21 +1,69 @@
 ﻿#include "SaveSystemSubsystem.h"
 #include "FWSCore.h"
-#include "PlatformFeatures.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerState.h"
-#include "SaveGameSystem.h"
 #include "Async/Async.h"
 #include "Engine/LocalPlayer.h"
 #include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
 #include "SaveIdComponent.h"
+#include "SaveIdRegistry.h"
 #include "GameFramework/Actor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "SaveSystem.h"
+#include "SaveProfileContext.h"
+#include "SaveSlotFormat.h"
+#include "SaveJournal.h"
+#include "SaveSlotStorage.h"
+#include "SaveProfileIndex.h"
+#include "SaveCloudSync.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Tasks/Task.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "FWSCore/EOS/EOSUnifiedSubsystem.h"
 #include "FWSCore/Player/PlayerProfileComponent.h"
 
 
 namespace { static const FName PROFILE_OBJECT_ID(TEXT("Profile")); }
 
+DECLARE_STATS_GROUP(TEXT("FWS Save"), STATGROUP_FWSSave, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Save gather (SaveData)"), STAT_FWSSave_Gather, STATGROUP_FWSSave);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Save gather objects"), STAT_FWSSave_GatherObjects, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last save gather (ms)"), STAT_FWSSave_SaveGatherMs, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last save serialize (ms)"), STAT_FWSSave_SaveSerializeMs, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last save write (ms)"), STAT_FWSSave_SaveWriteMs, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last save queue wait (ms)"), STAT_FWSSave_SaveQueueMs, STATGROUP_FWSSave);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Last save bytes"), STAT_FWSSave_SaveBytes, STATGROUP_FWSSave);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Last save dirty objects"), STAT_FWSSave_SaveDirty, STATGROUP_FWSSave);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Slot objects"), STAT_FWSSave_SlotObjects, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last load apply (ms)"), STAT_FWSSave_LoadGatherMs, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last load decode (ms)"), STAT_FWSSave_LoadSerializeMs, STATGROUP_FWSSave);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last load read (ms)"), STAT_FWSSave_LoadReadMs, STATGROUP_FWSSave);
+
+CSV_DEFINE_CATEGORY(FWSSave, true);
+
+namespace
+{
+	FSaveStats MakeStats(const USaveProfileContext& Ctx, ESaveStatsOp Op)
+	{
+		FSaveStats Stats;
+		Stats.Op = Op;
+		Stats.SlotName = Ctx.SaveSlotName;
+		Stats.LocalUserNum = Ctx.LocalUserNum;
+		return Stats;
+	}
+
+	float ToMs(double Seconds) { return static_cast<float>(Seconds * 1000.0); }
+}
+
 /* ---------- Internal helpers ---------- */
 
 static float GetAutosaveJitter(float BaseSeconds)
@@ -27,6 +75,16 @@ void USaveSystemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	SaveStatsHistory.SetCapacity(StatsHistoryLength);
+	LoadStatsHistory.SetCapacity(StatsHistoryLength);
+
+	// The primary profile's context; other local players get theirs when they mount a profile.
+	USaveProfileContext* Primary = NewObject<USaveProfileContext>(this);
+	Contexts.Add(0, Primary);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &USaveSystemSubsystem::HandleLevelAdded);
+	LevelRemovedHandle = FWorldDelegates::PreLevelRemovedFromWorld.AddUObject(this, &USaveSystemSubsystem::HandleLevelRemoved);
+
 	// Grab EOS subsystem once.
 	if (UGameInstance* GI = GetGameInstance())
 	{
@@ -49,20 +107,49 @@ void USaveSystemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void USaveSystemSubsystem::Deinitialize()
 {
 	StopAutosaveTimer();
+	CancelRespawn();
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		CancelPendingLoad(*Pair.Value);
+		FinishPendingGather(*Pair.Value);
+	}
 
-	if (UWorld* W = GetWorld())
+	// Nobody is left to hear about it.
+	if (CloudSync)
 	{
-		W->GetTimerManager().ClearTimer(DebouncedSaveHandle);
+		CloudSync->OnFinished = nullptr;
+		CloudSync->Cancel();
+		CloudSync.Reset();
 	}
 
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::PreLevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
 	if (EOSSub)
 	{
 		EOSSub->OnAuthStateChanged.RemoveAll(this);
 		EOSSub = nullptr;
 	}
-	
-	bSaveInFlight = false;
-	bSavePending  = false;
+
+	FTSTicker::GetCoreTicker().RemoveTicker(SaveSchedulerTickHandle);
+	SaveSchedulerTickHandle.Reset();
+	SaveScheduler.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(CompactionTickHandle);
+	CompactionTickHandle.Reset();
+	Compaction.Reset();
+
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		USaveProfileContext& Ctx = *Pair.Value;
+
+		// Let in-flight worker I/O land before the subsystem goes away.
+		Ctx.PendingReadTask.Wait();
+		Ctx.PendingWriteTask.Wait();
+		FinishChunkFlushes(Ctx);
+		Ctx.bSaveInFlight = false;
+	}
+	Contexts.Reset();
 
 	Super::Deinitialize();
 }
@@ -92,7 +179,8 @@ void USaveSystemSubsystem::ResolveLoadForAllLocalPlayers(bool bApplyAfterLoad)
 	}
 #endif
 
-	// Iterate all local players (handles split-screen too).
+	// Iterate all local players (handles split-screen too). Each profile mounts into its player's own
+	// context, so their slots are read in parallel rather than one after another.
 	const TArray<ULocalPlayer*>& LPs = GI->GetLocalPlayers();
 	for (ULocalPlayer* LP : LPs)
 	{
@@ -246,27 +334,30 @@ void USaveSystemSubsystem::InitializeSystem(bool bPrintDebug)
 	}
 
 	// Decide initial slot purely by identity (no side effects)
-	SaveSlotName = ResolveSlotName();
+	USaveProfileContext& Ctx = GetPrimary();
+	Ctx.SaveSlotName = ResolveSlotName();
 
 	// Load or create
-	if (UGameplayStatics::DoesSaveGameExist(SaveSlotName, 0))
+	if (SaveSlotStorage::Exists(Ctx.SaveSlotName))
 	{
-		CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::LoadGameFromSlot(SaveSlotName, 0));
-		if (!CurrentSaveSystem)
+		Ctx.CurrentSaveSystem = ReadSlot(Ctx.SaveSlotName);
+		if (!Ctx.CurrentSaveSystem)
 		{
-			CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+			Ctx.CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+			Ctx.CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
 		}
-		ExecuteLoad(false);
+		ExecuteLoad(Ctx, false);
+		UpdateProfileIndex(Ctx.SaveSlotName, Ctx.CurrentSaveSystem);
 		if (bPrintDebugOutput)
-			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loaded Save Slot: %s"), *SaveSlotName);
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loaded Save Slot: %s"), *Ctx.SaveSlotName);
 	}
 	else
 	{
-		CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
-		CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
-		UGameplayStatics::SaveGameToSlot(CurrentSaveSystem, SaveSlotName, 0);
+		Ctx.CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+		Ctx.CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
+		WriteSlot(Ctx);
 		if (bPrintDebugOutput)
-			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Created Save Slot: %s"), *SaveSlotName);
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Created Save Slot: %s"), *Ctx.SaveSlotName);
 	}
 
 	bInitialised = true;
@@ -276,23 +367,23 @@ void USaveSystemSubsystem::InitializeSystem(bool bPrintDebug)
 		const FIdentityData Id = GatherEOSIdentity(GetGameInstance(), [this](const FString& S){ return SanitizeSlotName(S); });
 
 		// Write meta if available
-		if (!Id.DisplayName.IsEmpty()) CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("DisplayName"), Id.DisplayName);
-		if (!Id.PUID.IsEmpty())       CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("PUID"),        Id.PUID);
-		if (!Id.EAS.IsEmpty())        CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("EAS"),         Id.EAS);
+		if (!Id.DisplayName.IsEmpty()) Ctx.CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("DisplayName"), Id.DisplayName);
+		if (!Id.PUID.IsEmpty())       Ctx.CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("PUID"),        Id.PUID);
+		if (!Id.EAS.IsEmpty())        Ctx.CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("EAS"),         Id.EAS);
 
 		// If we ended up on a fallback slot but EOS is ready with a better key, switch once.
-		if (!Id.PreferredSlotKey.IsEmpty() && Id.PreferredSlotKey != SaveSlotName)
+		if (!Id.PreferredSlotKey.IsEmpty() && Id.PreferredSlotKey != Ctx.SaveSlotName)
 		{
 			if (bPrintDebugOutput)
 			{
 				UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Switching to EOS-preferred slot: %s (from %s)"),
-					*Id.PreferredSlotKey, *SaveSlotName);
+					*Id.PreferredSlotKey, *Ctx.SaveSlotName);
 			}
 			SwitchProfile(Id.PreferredSlotKey);
 			// Re-apply meta after switch (CurrentSaveSystem changed)
-			if (!Id.DisplayName.IsEmpty()) CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("DisplayName"), Id.DisplayName);
-			if (!Id.PUID.IsEmpty())       CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("PUID"),        Id.PUID);
-			if (!Id.EAS.IsEmpty())        CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("EAS"),         Id.EAS);
+			if (!Id.DisplayName.IsEmpty()) Ctx.CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("DisplayName"), Id.DisplayName);
+			if (!Id.PUID.IsEmpty())       Ctx.CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("PUID"),        Id.PUID);
+			if (!Id.EAS.IsEmpty())        Ctx.CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, TEXT("EAS"),         Id.EAS);
 		}
 	}
 
@@ -309,22 +400,17 @@ FString USaveSystemSubsystem::ResolveSlotName()
 	FString Result = Id.PreferredSlotKey;
 
 	// If the chosen key doesn't exist and there *is* an existing slot on disk, prefer that (helps first boot / renamed ids)
-	if (ISaveGameSystem* UESaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem())
+	const TArray<FProfileSlotInfo>& Slots = GetProfileIndex();
+	if (Slots.Num() > 0)
 	{
-		TArray<FString> Slots;
-		UESaveSystem->GetSaveGameNames(Slots, 0);
-
-		if (Slots.Num() > 0)
+		// If we picked "DefaultSaveSlot" but an older slot exists, stay on the most recently saved one for continuity
+		if (Result.Equals(TEXT("DefaultSaveSlot"), ESearchCase::IgnoreCase))
 		{
-			// If we picked "DefaultSaveSlot" but an older slot exists, stay on the first one for continuity
-			if (Result.Equals(TEXT("DefaultSaveSlot"), ESearchCase::IgnoreCase))
-			{
-				return SanitizeSlotName(Slots[0]);
-			}
-
-			// If our preferred key doesn't exist yet but exactly one slot exists, you may want to migrate later.
-			// We still return the preferred key here to start a fresh profile; comment out if you want auto-attach.
+			return SanitizeSlotName(Slots[0].SlotName);
 		}
+
+		// If our preferred key doesn't exist yet but exactly one slot exists, you may want to migrate later.
+		// We still return the preferred key here to start a fresh profile; comment out if you want auto-attach.
 	}
 
 	return Result;
@@ -336,7 +422,7 @@ void USaveSystemSubsystem::RegisterSaveable(UObject* Saveable)
 {
 	if (Saveable && Saveable->Implements<USaveable>())
 	{
-		RegisteredSaveables.AddUnique(Saveable);
+		RegisteredSaveables.Add(Saveable);
 	}
 }
 
@@ -349,313 +435,2479 @@ void USaveSystemSubsystem::UnregisterSaveable(AActor* DestroyedActor)
 {
 	if (ISaveable* Saveable = Cast<ISaveable>(DestroyedActor))
 	{
-		RegisteredSaveables.Remove(Cast<UObject>(DestroyedActor));
+		UnregisterSaveable(Cast<UObject>(DestroyedActor));
 	}
 }
 
-/* ---------- Public API ---------- */
+/* ---------- Contexts ---------- */
 
-void USaveSystemSubsystem::RequestSave(bool bAsync)
+USaveProfileContext& USaveSystemSubsystem::GetPrimary() const
 {
-	if (!CurrentSaveSystem)
+	return *Contexts.FindChecked(0);
+}
+
+USaveProfileContext* USaveSystemSubsystem::FindContext(int32 LocalUserNum) const
+{
+	return Contexts.FindRef(LocalUserNum);
+}
+
+int32 USaveSystemSubsystem::GetSaveableUserNum(const UObject* Obj)
+{
+	const AActor* Actor = Cast<AActor>(Obj);
+	if (!Actor && Obj)
 	{
-		UE_LOG(LogSaveSystem, Error, TEXT("[SaveSystemSubsystem] RequestSave failed: CurrentSaveSystem is null"));
-		return;
+		Actor = Obj->GetTypedOuter<AActor>();
 	}
 
-	if (bPrintDebugOutput)
+	// Possessed pawns and player states are owned by their controller.
+	for (; Actor; Actor = Actor->GetOwner())
 	{
-		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] RequestSave (Async=%s)"), bAsync ? TEXT("true") : TEXT("false"));
+		if (const APlayerController* PC = Cast<APlayerController>(Actor))
+		{
+			const ULocalPlayer* LP = PC->GetLocalPlayer();
+			return LP ? LP->GetLocalPlayerIndex() : 0;
+		}
 	}
+	return 0;
+}
 
-	// Debounce coalescing
-	bSavePending = true;
-	const float DebounceSeconds = 0.25f;
-	if (UWorld* World = GetWorld())
+USaveProfileContext& USaveSystemSubsystem::GetContextFor(const UObject* Obj) const
+{
+	// Single profile (no split-screen): skip the owner walk.
+	if (Contexts.Num() > 1)
 	{
-		World->GetTimerManager().SetTimer(
-			DebouncedSaveHandle,
-			[this, bAsync]()
-			{
-				if (!bSavePending) return;
-				bSavePending = false;
-				ExecuteSave(bAsync);
-			},
-			DebounceSeconds, false
-		);
+		if (USaveProfileContext* Ctx = FindContext(GetSaveableUserNum(Obj)))
+		{
+			return *Ctx;
+		}
 	}
+	return GetPrimary();
 }
 
-void USaveSystemSubsystem::RequestLoad(bool bAsync)
+void USaveSystemSubsystem::GatherContextRefs(const USaveProfileContext& Ctx, TArray<FSaveableRef>& OutRefs) const
 {
-	if (bPrintDebugOutput)
+	for (const FSaveableRef& Ref : RegisteredSaveables.GetRefs())
 	{
-		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] RequestLoad (Async=%s)"), bAsync ? TEXT("true") : TEXT("false"));
+		const UObject* Obj = Ref.Object.Get();
+		if (Obj && &GetContextFor(Obj) == &Ctx)
+		{
+			OutRefs.Add(Ref);
+		}
 	}
-	ExecuteLoad(bAsync);
 }
 
-void USaveSystemSubsystem::ExecuteLoad(bool /*bAsync*/)
+/* ---------- Public API ---------- */
+
+FString USaveSystemSubsystem::GetCurrentSlotName() const
 {
-	// Load the SaveGame from slot again (source of truth)
-	CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::LoadGameFromSlot(SaveSlotName, 0));
-	if (!CurrentSaveSystem)
+	const USaveProfileContext* Ctx = FindContext(0);
+	return Ctx ? Ctx->SaveSlotName : FString();
+}
+
+USaveSystem* USaveSystemSubsystem::GetCurrentSaveSystem() const
+{
+	const USaveProfileContext* Ctx = FindContext(0);
+	return Ctx ? Ctx->CurrentSaveSystem : nullptr;
+}
+
+bool USaveSystemSubsystem::IsSaveInFlight() const
+{
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
 	{
-		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] ExecuteLoad: No save exists for %s. Creating fresh."), *SaveSlotName);
-		CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+		if (Pair.Value->bSaveInFlight) return true;
 	}
+	return false;
+}
 
-	TArray<UObject*> ValidObjects;
-	for (const TWeakObjectPtr<UObject>& Obj : RegisteredSaveables)
+bool USaveSystemSubsystem::IsLoadInProgress() const
+{
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
 	{
-		if (Obj.IsValid())
-		{
-			ValidObjects.Add(Obj.Get());
-		}
+		if (Pair.Value->IsLoadInProgress()) return true;
 	}
+	return false;
+}
 
-	CurrentSaveSystem->LoadAllData(ValidObjects);
-
-	if (bPrintDebugOutput)
+int32 USaveSystemSubsystem::GetNumResidentChunks() const
+{
+	int32 Num = 0;
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
 	{
-		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loaded %d objects from slot %s"),
-			ValidObjects.Num(), *SaveSlotName);
+		Num += Pair.Value->ResidentChunks.Num();
 	}
+	return Num;
 }
 
-void USaveSystemSubsystem::ExecuteSave(bool bAsync)
+void USaveSystemSubsystem::RequestSave(bool bAsync, ESavePriority Priority)
 {
-	if (!CurrentSaveSystem)
+	if (bPrintDebugOutput)
 	{
-		UE_LOG(LogSaveSystem, Error, TEXT("[SaveSystemSubsystem] ExecuteSave failed: CurrentSaveSystem is null"));
-		return;
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] RequestSave (Async=%s, Priority=%s)"), bAsync ? TEXT("true") : TEXT("false"),
+			*UEnum::GetValueAsString(Priority));
 	}
 
-	OnSaveStarted.Broadcast(SaveSlotName);
-
-	// Stamp version for this write; SaveAllData updates timestamp
-	CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		RequestSave(*Pair.Value, bAsync, Priority);
+	}
+}
 
-	if (!bAsync)
+void USaveSystemSubsystem::RequestSave(USaveProfileContext& Ctx, bool bAsync, ESavePriority Priority)
+{
+	// A player whose first load is still reading saves once it lands (ExecuteSave finishes it).
+	if (!Ctx.CurrentSaveSystem && !Ctx.IsLoadInProgress())
 	{
-		const bool bOk = PerformSaveSync();
-		OnSaveFinished.Broadcast(SaveSlotName, bOk);
+		UE_LOG(LogSaveSystem, Error, TEXT("[SaveSystemSubsystem] RequestSave failed: no save object for local player %d"), Ctx.LocalUserNum);
 		return;
 	}
 
-	// Async branch: collapse overlapping saves
-	if (bSaveInFlight)
+	SaveScheduler.Submit(Ctx.LocalUserNum, Priority, bAsync, FPlatformTime::Seconds());
+	if (!SaveSchedulerTickHandle.IsValid())
 	{
-		if (bPrintDebugOutput)
-		{
-			UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveSystemSubsystem] Async save already in flight; collapsing."));
-		}
-		return;
+		SaveSchedulerTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USaveSystemSubsystem::TickSaveScheduler));
 	}
-	bSaveInFlight = true;
-	PerformSaveAsync();
 }
 
-bool USaveSystemSubsystem::PerformSaveSync()
+bool USaveSystemSubsystem::TickSaveScheduler(float DeltaTime)
 {
-	TArray<UObject*> ValidObjects;
-	for (const TWeakObjectPtr<UObject>& Obj : RegisteredSaveables)
+	FSaveScheduler::FPolicy& Policy = SaveScheduler.Policy;
+	Policy.SettleSeconds = SaveSettleSeconds;
+	Policy.MinIntervalSeconds = MinSaveIntervalSeconds;
+	Policy.MaxDelaySeconds = MaxSaveDelaySeconds;
+	Policy.FrameBudgetMs = SaveFrameBudgetMs;
+
+	// One write at a time across all profiles: the next one starts once the running one is acknowledged.
+	int32 LocalUserNum = INDEX_NONE;
+	bool bAsync = true;
+	if (SaveScheduler.PickNext(FPlatformTime::Seconds(), DeltaTime * 1000.f, IsSaveInFlight(), LocalUserNum, bAsync))
 	{
-		if (Obj.IsValid())
+		// Unmounted since the request: its objects already went out with UnmountPlayer.
+		if (USaveProfileContext* Ctx = FindContext(LocalUserNum))
 		{
-			ValidObjects.Add(Obj.Get());
+			ExecuteSave(*Ctx, bAsync);
 		}
 	}
 
-	// Must run on GT
-	CurrentSaveSystem->SaveAllData(ValidObjects);
-
-	const bool bOk = UGameplayStatics::SaveGameToSlot(CurrentSaveSystem, SaveSlotName, 0);
+	if (SaveScheduler.HasPending())
+	{
+		return true;
+	}
+	SaveSchedulerTickHandle.Reset();
+	return false;
+}
 
-	static int32 SaveCounter = 0;
-	if (bOk && (++SaveCounter % 5) == 0) // rotate a backup periodically
+void USaveSystemSubsystem::SaveNow(bool bAsync)
+{
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
 	{
-		const FString Backup = SaveSlotName + TEXT(".bak");
-		UGameplayStatics::SaveGameToSlot(CurrentSaveSystem, Backup, 0);
+		USaveProfileContext& Ctx = *Pair.Value;
+		SaveScheduler.Cancel(Ctx.LocalUserNum);
+		ExecuteSave(Ctx, bAsync);
 	}
+}
 
+void USaveSystemSubsystem::RequestLoad(bool bAsync)
+{
 	if (bPrintDebugOutput)
 	{
-		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Saved %d objects to slot %s (ok=%d)"),
-			ValidObjects.Num(), *SaveSlotName, bOk ? 1 : 0);
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] RequestLoad (Async=%s)"), bAsync ? TEXT("true") : TEXT("false"));
 	}
 
-	return bOk;
+	// Async: every profile's read is on a worker before any of them is applied.
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		ExecuteLoad(*Pair.Value, bAsync);
+	}
 }
 
-void USaveSystemSubsystem::PerformSaveAsync()
+void USaveSystemSubsystem::ExecuteLoad(USaveProfileContext& Ctx, bool bAsync)
 {
-	// Snapshot what you need
-	const TArray<TWeakObjectPtr<UObject>> ObjectsToSave = RegisteredSaveables;
-	USaveSystem* SaveObj = CurrentSaveSystem;
-	const FString Slot = SaveSlotName;
-	const bool bDebug = bPrintDebugOutput;
-	const int32 Version = CurrentSaveVersion;
+	CancelPendingLoad(Ctx);
+
+	// A save mid-gather writes out what it captured before the slot is read back, and so do chunks changed since.
+	FinishPendingGather(Ctx);
+	FlushResidentChunks(Ctx);
+
+	// Read + decode on a worker; only the apply runs on the game thread, in slices.
+	if (bAsync && GetWorld())
+	{
+		BeginAsyncLoad(Ctx, /*bFromProfileSwitch*/false);
+		return;
+	}
+
+	const double LoadStartSeconds = FPlatformTime::Seconds();
+	Ctx.PendingLoadSlot = Ctx.SaveSlotName;
+	Ctx.PendingLoadStats = MakeStats(Ctx, ESaveStatsOp::Load);
+
+	// Load the SaveGame from slot again (source of truth), once queued writes have landed.
+	Ctx.PendingWriteTask.Wait();
+	const double ReadStartSeconds = FPlatformTime::Seconds();
+	FSaveIoTimings Timings;
+	Ctx.CurrentSaveSystem = ReadSlot(Ctx.SaveSlotName, &Timings);
+
+	FSaveStats& Stats = Ctx.PendingLoadStats;
+	Stats.QueueWaitMs = ToMs(ReadStartSeconds - LoadStartSeconds + Timings.LockWaitSeconds);
+	Stats.SerializeMs = ToMs(Timings.SerializeSeconds);
+	Stats.WriteMs = ToMs(Timings.IoSeconds);
+	Stats.Bytes = Timings.Bytes;
+	if (!Ctx.CurrentSaveSystem)
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] ExecuteLoad: No save exists for %s. Creating fresh."), *Ctx.SaveSlotName);
+		Ctx.CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+		Ctx.CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
+	}
+	ApplyLoadedSave(Ctx, /*bSliced*/false, LoadStartSeconds, {});
+}
+
+void USaveSystemSubsystem::BeginAsyncLoad(USaveProfileContext& Ctx, bool bFromProfileSwitch)
+{
+	const TSharedRef<FAsyncSlotRead, ESPMode::ThreadSafe> Read = MakeShared<FAsyncSlotRead, ESPMode::ThreadSafe>();
+	Read->Slot = Ctx.SaveSlotName;
+	Read->bFromProfileSwitch = bFromProfileSwitch;
+
+	// Prefetch the chunks of the levels loaded right now; anything streamed in meanwhile is read on demand.
+	if (bPartitionStreamedLevels)
+	{
+		TArray<FSaveableRef> MainRefs;
+		TMap<FName, TArray<FSaveableRef>> ChunkRefs;
+		GatherRefsByPartition(Ctx, MainRefs, ChunkRefs);
+		for (const TPair<FName, TArray<FSaveableRef>>& Pair : ChunkRefs)
+		{
+			Read->Chunks.AddDefaulted_GetRef().Partition = Pair.Key;
+		}
+	}
+
+	Ctx.PendingRead = Read;
+	Ctx.PendingLoadSlot = Ctx.SaveSlotName;
+	Ctx.PendingLoadStats = MakeStats(Ctx, ESaveStatsOp::Load);
 
+	const bool bDebug = bPrintDebugOutput;
+	const double LaunchSeconds = FPlatformTime::Seconds();
 	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	TWeakObjectPtr<USaveProfileContext> WeakCtx(&Ctx);
 
-	// Defer to GT (UObject traversal + SaveGameToSlot are GT-bound)
-	AsyncTask(ENamedThreads::GameThread, [WeakThis, ObjectsToSave, SaveObj, Slot, bDebug, Version]()
+	// Chained after the profile's queued writes so the read sees them; other profiles' I/O doesn't hold it up.
+	Ctx.PendingReadTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Read, WeakThis, WeakCtx, bDebug, LaunchSeconds]()
 	{
-		if (!WeakThis.IsValid())
+		const double WorkerStart = FPlatformTime::Seconds();
+		Read->QueueWaitSeconds = WorkerStart - LaunchSeconds;
+		Read->bFound = ReadSlotSnapshot(Read->Slot, Read->Snapshot, Read->LegacyBytes, &Read->Timings);
+		for (FAsyncSlotRead::FChunk& Chunk : Read->Chunks)
+		{
+			TArray<uint8> Unused;
+			Chunk.bFound = ReadSlotSnapshot(SaveSlotStorage::GetChunkSlot(Read->Slot, Chunk.Partition), Chunk.Snapshot, Unused, &Read->Timings);
+		}
+
+		if (bDebug)
 		{
-			return;
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Async read of %s: %s, %d chunks (worker=%.2fms)"),
+				*Read->Slot, Read->bFound ? TEXT("OK") : TEXT("none"), Read->Chunks.Num(), (FPlatformTime::Seconds() - WorkerStart) * 1000.0);
 		}
 
-		USaveSystemSubsystem* Self = WeakThis.Get();
+		AsyncTask(ENamedThreads::GameThread, [Read, WeakThis, WeakCtx]()
+		{
+			// A newer load, a profile switch or a save that completed this read already took over.
+			USaveSystemSubsystem* Self = WeakThis.Get();
+			USaveProfileContext* Context = WeakCtx.Get();
+			if (Self && Context && Context->PendingRead == Read)
+			{
+				Self->CompleteAsyncLoad(*Context, /*bSliced*/true);
+			}
+		});
+	}, UE::Tasks::Prerequisites(Ctx.PendingWriteTask));
+}
+
+void USaveSystemSubsystem::CompleteAsyncLoad(USaveProfileContext& Ctx, bool bSliced)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+	const TSharedPtr<FAsyncSlotRead, ESPMode::ThreadSafe> Read = MoveTemp(Ctx.PendingRead);
+
+	FSaveStats& Stats = Ctx.PendingLoadStats;
+	Stats.QueueWaitMs = ToMs(Read->QueueWaitSeconds + Read->Timings.LockWaitSeconds);
+	Stats.WriteMs = ToMs(Read->Timings.IoSeconds);
+	Stats.Bytes = Read->Timings.Bytes;
+
+	USaveSystem* Loaded = Read->bFound ? MakeSaveObject(MoveTemp(Read->Snapshot), Read->LegacyBytes) : nullptr;
+	if (!Loaded)
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] ExecuteLoad: No save exists for %s. Creating fresh."), *Read->Slot);
+		Loaded = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+		Loaded->SaveVersion = CurrentSaveVersion;
+	}
+	Ctx.CurrentSaveSystem = Loaded;
+	if (Read->bFromProfileSwitch && Read->bFound)
+	{
+		UpdateProfileIndex(Read->Slot, Ctx.CurrentSaveSystem);
+	}
 
-		TArray<UObject*> ValidObjects;
-		for (const TWeakObjectPtr<UObject>& Obj : ObjectsToSave)
+	TMap<FName, USaveSystem*> Prefetched;
+	for (FAsyncSlotRead::FChunk& Chunk : Read->Chunks)
+	{
+		if (USaveSystem* ChunkObj = Chunk.bFound ? MakeSaveObject(MoveTemp(Chunk.Snapshot), {}) : nullptr)
 		{
-			if (Obj.IsValid()) { ValidObjects.Add(Obj.Get()); }
+			Prefetched.Add(Chunk.Partition, ChunkObj);
 		}
+	}
+	// Worker decode plus installing the snapshots here.
+	Stats.SerializeMs = ToMs(Read->Timings.SerializeSeconds + (FPlatformTime::Seconds() - StartSeconds));
+	ApplyLoadedSave(Ctx, bSliced, StartSeconds, MoveTemp(Prefetched));
+}
 
-		bool bOk = false;
+void USaveSystemSubsystem::ApplyLoadedSave(USaveProfileContext& Ctx, bool bSliced, double StartSeconds, TMap<FName, USaveSystem*>&& PrefetchedChunks)
+{
+	// Objects of streamed levels load from their partition chunks below, not from the profile slot.
+	// With one profile and no partitions every registered object is the context's, as registered.
+	TArray<FSaveableRef> MainRefs;
+	TMap<FName, TArray<FSaveableRef>> ChunkRefs;
+	const bool bAllRefs = !bPartitionStreamedLevels && Contexts.Num() == 1;
+	if (!bAllRefs)
+	{
+		GatherRefsByPartition(Ctx, MainRefs, ChunkRefs);
+	}
 
-		if (SaveObj)
+	// The primary profile's world state first: tombstoned actors are gone before anything resolves, and the
+	// previous load's respawns make way for this one's.
+	if (Ctx.LocalUserNum == 0)
+	{
+		CancelRespawn();
+		ApplyWorldState(Ctx, *Ctx.CurrentSaveSystem, NAME_None);
+	}
+	PublishReadSnapshot(Ctx);
+
+	// One pass resolves every payload (GUID/name lookups, lazy decodes); LoadData calls then run in slices.
+	const double ResolveStart = FPlatformTime::Seconds();
+	Ctx.CurrentSaveSystem->ResolveLoadBatch(bAllRefs ? RegisteredSaveables.GetRefs() : TConstArrayView<FSaveableRef>(MainRefs), Ctx.PendingLoad);
+	const double ResolveMs = (FPlatformTime::Seconds() - ResolveStart) * 1000.0;
+
+	// Chunks are re-read too (the disk is the source of truth); each is one level's worth, so it applies in one go.
+	// ExecuteLoad flushed the resident ones before the read, so any still here were read since and hold only
+	// changes made while the load was pending, which it reverts like the profile's own.
+	Ctx.ResidentChunks.Reset();
+	for (const TPair<FName, TArray<FSaveableRef>>& Pair : ChunkRefs)
+	{
+		if (USaveSystem* const* Prefetched = PrefetchedChunks.Find(Pair.Key))
 		{
-			SaveObj->SaveVersion   = Version;
-			SaveObj->SaveTimestamp = FDateTime::Now();
+			Ctx.ResidentChunks.Add(Pair.Key, *Prefetched);
+		}
+		ApplyChunk(Ctx, Pair.Key, Pair.Value);
+	}
 
-			// Must be on GT (interface calls / UObjects)
-			SaveObj->SaveAllData(ValidObjects);
+	UWorld* World = GetWorld();
+	const double Budget = (bSliced && World) ? LoadBudgetMsPerFrame / 1000.0 : 0.0;
+	const bool bDone = Ctx.CurrentSaveSystem->DispatchLoadBatch(Ctx.PendingLoad, Budget);
+	LastLoadGameThreadMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	FSaveStats& Stats = Ctx.PendingLoadStats;
+	Stats.GatherMs = ToMs(FPlatformTime::Seconds() - ResolveStart);
+	Stats.MaxFrameMs = LastLoadGameThreadMs;
+	Stats.Frames = 1;
+	Stats.ObjectCount = Ctx.PendingLoad.Items.Num();
+	for (const TPair<FName, TArray<FSaveableRef>>& Pair : ChunkRefs)
+	{
+		Stats.ObjectCount += Pair.Value.Num();
+	}
 
-			bOk = UGameplayStatics::SaveGameToSlot(SaveObj, Slot, 0);
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loading %d objects from slot %s (resolve=%.2fms, %s)"),
+			Ctx.PendingLoad.Items.Num(), *Ctx.SaveSlotName, ResolveMs, bDone ? TEXT("done") : TEXT("time-sliced"));
 
-			if (bDebug)
-			{
-				UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Async save write: %s"),
-					   bOk ? TEXT("OK") : TEXT("FAILED"));
-			}
+		if (const USaveIdRegistry* Registry = USaveIdRegistry::Get(this))
+		{
+			TArray<FGuid> Missing;
+			Registry->FindMissingGuids(Ctx.CurrentSaveSystem, Missing);
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] %d GUID payloads of %s have no actor in the world (%d registered ids)."),
+				Missing.Num(), *Ctx.SaveSlotName, Registry->Num());
 		}
+	}
 
-		Self->bSaveInFlight = false;
-		Self->OnSaveFinished.Broadcast(Slot, bOk);
-	});
+	if (bDone)
+	{
+		FinishLoad(Ctx);
+		return;
+	}
+	Ctx.PendingLoadSave = Ctx.CurrentSaveSystem;
+	Ctx.LoadSliceHandle = World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &USaveSystemSubsystem::ContinueSlicedLoad, Ctx.LocalUserNum));
 }
 
-/* ---------- Profiles ---------- */
-
-void USaveSystemSubsystem::SwitchProfile(FString NewProfileName)
+void USaveSystemSubsystem::ContinueSlicedLoad(int32 LocalUserNum)
 {
-	if (NewProfileName.IsEmpty()) return;
+	// The player was unmounted; its pending load went with it.
+	USaveProfileContext* CtxPtr = FindContext(LocalUserNum);
+	if (!CtxPtr) return;
 
-	StopAutosaveTimer();
+	USaveProfileContext& Ctx = *CtxPtr;
+	Ctx.LoadSliceHandle.Invalidate();
+
+	// The save object was replaced underneath us; its payload pointers are gone.
+	USaveSystem* SaveObj = Ctx.PendingLoadSave.Get();
+	if (!SaveObj || SaveObj != Ctx.CurrentSaveSystem)
+	{
+		CancelPendingLoad(Ctx);
+		return;
+	}
 
-	SaveSlotName = SanitizeSlotName(NewProfileName);
+	UWorld* World = GetWorld();
+	const double SliceStartSeconds = FPlatformTime::Seconds();
+	const bool bDone = SaveObj->DispatchLoadBatch(Ctx.PendingLoad, World ? LoadBudgetMsPerFrame / 1000.0 : 0.0);
+	const float SliceMs = ToMs(FPlatformTime::Seconds() - SliceStartSeconds);
+	LastLoadGameThreadMs = FMath::Max(LastLoadGameThreadMs, SliceMs);
 
-	if (UGameplayStatics::DoesSaveGameExist(SaveSlotName, 0))
+	FSaveStats& Stats = Ctx.PendingLoadStats;
+	Stats.GatherMs += SliceMs;
+	Stats.MaxFrameMs = FMath::Max(Stats.MaxFrameMs, SliceMs);
+	++Stats.Frames;
+
+	if (bDone)
 	{
-		CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::LoadGameFromSlot(SaveSlotName, 0));
-		ExecuteLoad(false);
 		if (bPrintDebugOutput)
-			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loaded Save Slot: %s"), *SaveSlotName);
+		{
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Time-sliced load of %s finished (%d objects)."),
+				*Ctx.SaveSlotName, Ctx.PendingLoad.Items.Num());
+		}
+		FinishLoad(Ctx);
+		return;
 	}
-	else
+	Ctx.LoadSliceHandle = World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &USaveSystemSubsystem::ContinueSlicedLoad, LocalUserNum));
+}
+
+void USaveSystemSubsystem::FinishPendingLoad(USaveProfileContext& Ctx)
+{
+	if (!Ctx.IsLoadInProgress()) return;
+
+	if (Ctx.PendingRead.IsValid())
 	{
-		CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
-		CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
-		UGameplayStatics::SaveGameToSlot(CurrentSaveSystem, SaveSlotName, 0);
-		if (bPrintDebugOutput)
-			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Created Save Slot: %s"), *SaveSlotName);
+		// Nothing is applied yet: block on the read rather than let a save write the previous state.
+		Ctx.PendingReadTask.Wait();
+		CompleteAsyncLoad(Ctx, /*bSliced*/false);
+		return;
 	}
 
-	OnProfileChanged.Broadcast(SaveSlotName);
-	
-	if (bEnableAutoSave)
+	if (USaveSystem* SaveObj = Ctx.PendingLoadSave.Get(); SaveObj && SaveObj == Ctx.CurrentSaveSystem)
 	{
-		StartAutosaveTimer();
+		const double StartSeconds = FPlatformTime::Seconds();
+		SaveObj->DispatchLoadBatch(Ctx.PendingLoad, 0.0);
+		const float RestMs = ToMs(FPlatformTime::Seconds() - StartSeconds);
+		Ctx.PendingLoadStats.GatherMs += RestMs;
+		Ctx.PendingLoadStats.MaxFrameMs = FMath::Max(Ctx.PendingLoadStats.MaxFrameMs, RestMs);
+		FinishLoad(Ctx);
+		return;
 	}
+	CancelPendingLoad(Ctx);
 }
 
-TArray<FString> USaveSystemSubsystem::GetAvailableProfiles()
+void USaveSystemSubsystem::CancelPendingLoad(USaveProfileContext& Ctx)
 {
-	ISaveGameSystem* UESaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
-	TArray<FString> Slots;
-	if (UESaveSystem)
+	if (!Ctx.IsLoadInProgress())
 	{
-		UESaveSystem->GetSaveGameNames(Slots, 0);
+		ResetPendingLoad(Ctx);
+		return;
 	}
-	return Slots;
+
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Load of %s cancelled."), *Ctx.PendingLoadSlot);
+	}
+	const FString Slot = Ctx.PendingLoadSlot;
+	FSaveStats Stats = MoveTemp(Ctx.PendingLoadStats);
+	ResetPendingLoad(Ctx);
+	RecordStats(Stats);
+	OnLoadFinished.Broadcast(Slot, false);
 }
 
-void USaveSystemSubsystem::AddNewProfile(FString NewProfileName)
+void USaveSystemSubsystem::FinishLoad(USaveProfileContext& Ctx)
 {
-	if (NewProfileName.IsEmpty()) return;
-	if (UGameplayStatics::DoesSaveGameExist(NewProfileName, 0)) return;
-
-	SwitchProfile(NewProfileName);
+	const FString Slot = Ctx.PendingLoadSlot;
+	FSaveStats Stats = MoveTemp(Ctx.PendingLoadStats);
+	Stats.bSuccess = true;
+	Stats.SlotObjectCount = Ctx.CurrentSaveSystem ? Ctx.CurrentSaveSystem->GetNumObjects() : 0;
+	ResetPendingLoad(Ctx);
+	RecordStats(Stats);
+	OnLoadFinished.Broadcast(Slot, true);
+
+	// The slot was just read back in full, so this is when stale payloads show; the pass runs in the background.
+	if (bCompactAfterLoad && StaleRetentionSessions > 0)
+	{
+		CompactSaveData();
+	}
 }
 
-void USaveSystemSubsystem::DeleteProfile(const FString& ProfileName)
+void USaveSystemSubsystem::ResetPendingLoad(USaveProfileContext& Ctx)
 {
-	if (!ProfileName.IsEmpty() && UGameplayStatics::DoesSaveGameExist(ProfileName, 0))
+	if (Ctx.LoadSliceHandle.IsValid())
 	{
-		UGameplayStatics::DeleteGameInSlot(ProfileName, 0);
-		if (bPrintDebugOutput)
+		if (UWorld* W = GetWorld())
 		{
-			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Deleted Save Slot: %s"), *ProfileName);
+			W->GetTimerManager().ClearTimer(Ctx.LoadSliceHandle);
 		}
+		Ctx.LoadSliceHandle.Invalidate();
 	}
+	Ctx.PendingLoad.Reset();
+	Ctx.PendingLoadSave.Reset();
+	// An in-flight worker read finishes on its own; its result is dropped because it no longer matches.
+	Ctx.PendingRead.Reset();
+	Ctx.PendingLoadSlot.Reset();
+	Ctx.PendingLoadStats = FSaveStats();
 }
 
-/* ---------- Edit Helpers ---------- */
-
-FSaveObjectData* USaveSystemSubsystem::FindOrCreateSaveObject(FName ObjectId)
+void USaveSystemSubsystem::ExecuteSave(USaveProfileContext& Ctx, bool bAsync)
 {
-	if (!CurrentSaveSystem) return nullptr;
-	return &CurrentSaveSystem->GetOrCreateObject(ObjectId);
-}
+	// Objects still waiting for their LoadData would otherwise save default state over their data.
+	// For a profile whose first read is still running this also installs its save object.
+	FinishPendingLoad(Ctx);
 
-FSaveObjectData USaveSystemSubsystem::FindOrCreateSaveObject_BP(FName ObjectId)
-{
-	// BP copy semantics; edits should be done via EditObjectField to persist
-	if (!CurrentSaveSystem)
+	if (!Ctx.CurrentSaveSystem)
 	{
-		FSaveObjectData Tmp; return Tmp;
+		UE_LOG(LogSaveSystem, Error, TEXT("[SaveSystemSubsystem] ExecuteSave failed: CurrentSaveSystem is null"));
+		return;
 	}
-	return CurrentSaveSystem->GetOrCreateObject(ObjectId);
+
+	OnSaveStarted.Broadcast(Ctx.SaveSlotName);
+
+	// Stamp version for this write; the gather updates timestamp
+	Ctx.CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
+
+	if (!bAsync)
+	{
+		// An async save still gathering goes out first, so journal records stay in order.
+		FinishPendingGather(Ctx);
+		const bool bOk = PerformSaveSync(Ctx);
+		OnSaveFinished.Broadcast(Ctx.SaveSlotName, bOk);
+		return;
+	}
+
+	// Async branch: collapse overlapping saves
+	if (Ctx.bSaveInFlight)
+	{
+		if (bPrintDebugOutput)
+		{
+			UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveSystemSubsystem] Async save of %s already in flight; collapsing."), *Ctx.SaveSlotName);
+		}
+		return;
+	}
+	Ctx.bSaveInFlight = true;
+	PerformSaveAsync(Ctx);
 }
 
-FGuid USaveSystemSubsystem::GetOrCreateSaveGuid(AActor* Actor)
+bool USaveSystemSubsystem::PerformSaveSync(USaveProfileContext& Ctx)
 {
-	if (!Actor) return FGuid();
+	const double StartSeconds = FPlatformTime::Seconds();
+	FSaveStats Stats = MakeStats(Ctx, ESaveStatsOp::Save);
 
-	USaveIdComponent* Idc = Actor->FindComponentByClass<USaveIdComponent>();
-	if (!Idc)
+	// Never interleave with a worker write for the same slot (journal order / image replacement), and let its
+	// outcome decide this save's jobs: after a failed delta only a full image keeps the journal gap-free.
+	Ctx.PendingWriteTask.Wait();
+	const double WaitedSeconds = FPlatformTime::Seconds();
+
+	// Must run on GT
+	TArray<FSaveWriteJob> Jobs;
+	const int32 NumObjects = GatherAndPrepareJobs(Ctx, Jobs);
+	const double GatheredSeconds = FPlatformTime::Seconds();
+
+	bool bOk = true;
+	FSaveIoTimings Timings;
+	for (const FSaveWriteJob& Job : Jobs)
 	{
-		Idc = NewObject<USaveIdComponent>(Actor, USaveIdComponent::StaticClass(), TEXT("SaveIdComponent"));
-		Idc->RegisterComponent();
+		const bool bJobOk = RunWriteJob(Job, &Timings);
+		AcknowledgeWriteJob(Job, bJobOk);
+		bOk &= bJobOk;
 	}
-	return Idc->GetOrCreateGuid();
+	LastSaveBytesWritten = Timings.Bytes;
+	if (bOk)
+	{
+		UpdateProfileIndex(Ctx.SaveSlotName, Ctx.CurrentSaveSystem);
+	}
+
+	LastSaveGameThreadMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Saved %d objects to slot %s (ok=%d, %s, %d chunks, GT=%.2fms)"),
+			NumObjects, *Ctx.SaveSlotName, bOk ? 1 : 0, *Jobs[0].Describe(), Jobs.Num() - 1, LastSaveGameThreadMs);
+	}
+
+	Stats.bSuccess = bOk;
+	Stats.GatherMs = ToMs(GatheredSeconds - WaitedSeconds);
+	Stats.QueueWaitMs = ToMs(WaitedSeconds - StartSeconds);
+	Stats.MaxFrameMs = LastSaveGameThreadMs;
+	Stats.Frames = 1;
+	Stats.ObjectCount = NumObjects;
+	Stats.SlotObjectCount = Ctx.CurrentSaveSystem->GetNumObjects();
+	AddWriteResults(Stats, Jobs, Timings);
+	RecordStats(Stats);
+
+	return bOk;
 }
 
-FSaveObjectData* USaveSystemSubsystem::FindOrCreateSaveObjectByGuid(const FGuid& Guid)
+void USaveSystemSubsystem::PerformSaveAsync(USaveProfileContext& Ctx)
 {
-	if (!CurrentSaveSystem) return nullptr;
-	return &CurrentSaveSystem->GetOrCreateObjectByGuid(Guid);
+	// Legacy comparison path: gather + encode + write all on the game thread.
+	if (!bWriteOnWorkerThread)
+	{
+		const bool bOk = PerformSaveSync(Ctx);
+		Ctx.bSaveInFlight = false;
+		OnSaveFinished.Broadcast(Ctx.SaveSlotName, bOk);
+		return;
+	}
+
+	// GT-bound part: interface calls into UObjects, spread over frames; the write starts once every object is in.
+	BeginGather(Ctx, Ctx.PendingGather);
+	ContinueSaveGather(Ctx.LocalUserNum);
 }
 
-FSaveObjectData USaveSystemSubsystem::FindOrCreateSaveObjectByGuid_BP(const FGuid& Guid)
+void USaveSystemSubsystem::ContinueSaveGather(int32 LocalUserNum)
 {
-	if (!CurrentSaveSystem) { FSaveObjectData Tmp; return Tmp; }
-	return CurrentSaveSystem->GetOrCreateObjectByGuid(Guid);
+	USaveProfileContext* CtxPtr = FindContext(LocalUserNum);
+	if (!CtxPtr) return;
+
+	USaveProfileContext& Ctx = *CtxPtr;
+	Ctx.GatherSliceHandle.Invalidate();
+
+	UWorld* World = GetWorld();
+	const double BudgetSeconds = World ? SaveGatherBudgetMsPerFrame / 1000.0 : 0.0;
+	if (!RunGather(Ctx, Ctx.PendingGather, BudgetSeconds))
+	{
+		Ctx.GatherSliceHandle = World->GetTimerManager().SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &USaveSystemSubsystem::ContinueSaveGather, LocalUserNum));
+		return;
+	}
+	LaunchGatheredWrite(Ctx);
 }
 
-void USaveSystemSubsystem::EditObjectField(FName ObjectId, FName Key, const FString& NewValue, bool bSaveImmediately)
+void USaveSystemSubsystem::FinishPendingGather(USaveProfileContext& Ctx)
 {
+	// A gather still has work left exactly while its next slice is armed.
+	if (!Ctx.GatherSliceHandle.IsValid())
+	{
+		return;
+	}
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(Ctx.GatherSliceHandle);
+	}
+	Ctx.GatherSliceHandle.Invalidate();
+	RunGather(Ctx, Ctx.PendingGather, 0.0);
+	LaunchGatheredWrite(Ctx);
+}
+
+void USaveSystemSubsystem::LaunchGatheredWrite(USaveProfileContext& Ctx)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// Value copy of the full image or just the dirty objects; from here on the save object is free to change.
+	TArray<FSaveWriteJob> Jobs;
+	PrepareGatheredJobs(Ctx, Ctx.PendingGather, Jobs);
+
+	const FSaveGatherBatch& Gather = Ctx.PendingGather;
+	const double PrepareSeconds = FPlatformTime::Seconds() - StartSeconds;
+	LastSaveGatherFrames = Gather.Frames;
+	LastSaveGatherTotalMs = static_cast<float>(Gather.TotalSeconds * 1000.0);
+	LastSaveGameThreadMs = static_cast<float>(FMath::Max(Gather.MaxFrameSeconds, Gather.LastFrameSeconds + PrepareSeconds) * 1000.0);
+
+	FSaveStats Stats = MakeStats(Ctx, ESaveStatsOp::Save);
+	Stats.GatherMs = ToMs(Gather.TotalSeconds + PrepareSeconds);
+	Stats.MaxFrameMs = LastSaveGameThreadMs;
+	Stats.Frames = Gather.Frames;
+	Stats.ObjectCount = Gather.Items.Num();
+	Stats.SlotObjectCount = Ctx.CurrentSaveSystem->GetNumObjects();
+	Ctx.PendingGather.Reset();
+
+	const bool bDebug = bPrintDebugOutput;
+	const float GameThreadMs = LastSaveGameThreadMs;
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	TWeakObjectPtr<USaveProfileContext> WeakCtx(&Ctx);
+	const double LaunchSeconds = FPlatformTime::Seconds();
+
+	// Worker: encode + write (+ compaction when the journal grows); the result is marshalled back to GT.
+	Ctx.PendingWriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, WeakCtx, Jobs = MoveTemp(Jobs), bDebug, GameThreadMs, Stats, LaunchSeconds]() mutable
+	{
+		const double WorkerStart = FPlatformTime::Seconds();
+		FSaveIoTimings Timings;
+		TArray<bool> Results;
+		for (const FSaveWriteJob& Job : Jobs)
+		{
+			Results.Add(RunWriteJob(Job, &Timings));
+		}
+		const bool bOk = !Results.Contains(false);
+		const int64 BytesWritten = Timings.Bytes;
+
+		Stats.bSuccess = bOk;
+		Stats.QueueWaitMs = ToMs(WorkerStart - LaunchSeconds);
+		AddWriteResults(Stats, Jobs, Timings);
+
+		if (bDebug)
+		{
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Async save write: %s (%s, %d chunks, GT=%.2fms, worker=%.2fms)"),
+				bOk ? TEXT("OK") : TEXT("FAILED"), *Jobs[0].Describe(), Jobs.Num() - 1, GameThreadMs, (FPlatformTime::Seconds() - WorkerStart) * 1000.0);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakCtx, Jobs, Results = MoveTemp(Results), bOk, BytesWritten, Stats = MoveTemp(Stats)]() mutable
+		{
+			for (int32 i = 0; i < Jobs.Num(); ++i)
+			{
+				AcknowledgeWriteJob(Jobs[i], Results[i]);
+			}
+			if (USaveProfileContext* Context = WeakCtx.Get())
+			{
+				Context->bSaveInFlight = false;
+			}
+			if (USaveSystemSubsystem* Self = WeakThis.Get())
+			{
+				Self->LastSaveBytesWritten = BytesWritten;
+				if (bOk)
+				{
+					Self->UpdateProfileIndex(Jobs[0].Slot, Jobs[0].Owner.Get());
+				}
+				Self->RecordStats(Stats);
+				Self->OnSaveFinished.Broadcast(Jobs[0].Slot, bOk);
+			}
+		});
+	}, UE::Tasks::Prerequisites(Ctx.PendingWriteTask));
+}
+
+USaveSystem* USaveSystemSubsystem::ReadSlot(const FString& Slot, FSaveIoTimings* OutTimings) const
+{
+	FSaveSnapshot Snapshot;
+	TArray<uint8> LegacyBytes;
+	return ReadSlotSnapshot(Slot, Snapshot, LegacyBytes, OutTimings) ? MakeSaveObject(MoveTemp(Snapshot), LegacyBytes) : nullptr;
+}
+
+bool USaveSystemSubsystem::ReadSlotSnapshot(const FString& Slot, FSaveSnapshot& OutSnapshot, TArray<uint8>& OutLegacyBytes, FSaveIoTimings* OutTimings)
+{
+	FSaveIoTimings Unused;
+	FSaveIoTimings& Timings = OutTimings ? *OutTimings : Unused;
+
+	const double LockStart = FPlatformTime::Seconds();
+	FScopeLock Lock(&SaveJournal::GetSlotLock(Slot));
+	const double ReadStart = FPlatformTime::Seconds();
+	Timings.LockWaitSeconds += ReadStart - LockStart;
+
+	TArray<uint8> Bytes;
+	const bool bRead = SaveSlotStorage::ReadNewestValid(Slot, Bytes);
+	const double DecodeStart = FPlatformTime::Seconds();
+	Timings.IoSeconds += DecodeStart - ReadStart;
+	if (!bRead)
+	{
+		return false;
+	}
+	Timings.Bytes += Bytes.Num();
+
+	// Slots written before the FWS container are plain USaveGame blobs.
+	if (!SaveSlotFormat::IsContainer(Bytes))
+	{
+		OutLegacyBytes = MoveTemp(Bytes);
+		return true;
+	}
+
+	// The journal's own (small) read counts as decode; it can't be told apart from the replay.
+	ON_SCOPE_EXIT { Timings.SerializeSeconds += FPlatformTime::Seconds() - DecodeStart; };
+	if (!SaveSlotFormat::Read(Bytes, OutSnapshot))
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Slot %s is corrupt or from a newer build."), *Slot);
+		return false;
+	}
+
+	const int32 Replayed = SaveJournal::Replay(Slot, OutSnapshot);
+	if (Replayed > 0)
+	{
+		UE_LOG(LogSaveSystem, Verbose, TEXT("[SaveSystemSubsystem] Slot %s: replayed %d journal records."), *Slot, Replayed);
+	}
+	return true;
+}
+
+USaveSystem* USaveSystemSubsystem::MakeSaveObject(FSaveSnapshot&& Snapshot, const TArray<uint8>& LegacyBytes) const
+{
+	USaveSystem* SaveObj = nullptr;
+	if (LegacyBytes.Num() > 0)
+	{
+		SaveObj = Cast<USaveSystem>(UGameplayStatics::LoadGameFromMemory(LegacyBytes));
+	}
+	else if ((SaveObj = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass))))
+	{
+		SaveObj->ApplySnapshot(MoveTemp(Snapshot));
+	}
+
+	// Every payload carries the version it was written at; older ones migrate when first looked up.
+	if (SaveObj)
+	{
+		SaveObj->SaveVersion = CurrentSaveVersion;
+	}
+	return SaveObj;
+}
+
+bool USaveSystemSubsystem::WriteSlot(USaveProfileContext& Ctx)
+{
+	USaveSystem* SaveObj = Ctx.CurrentSaveSystem;
+	if (!SaveObj) return false;
+
+	Ctx.PendingWriteTask.Wait();
+
+	PublishReadSnapshot(Ctx);
+	SaveObj->bNeedsFullWrite = true;
+	const bool bOk = RunWriteJob(PrepareWriteJob(SaveObj, Ctx.SaveSlotName));
+	SaveObj->bNeedsFullWrite = !bOk;
+	if (bOk)
+	{
+		UpdateProfileIndex(Ctx.SaveSlotName, SaveObj);
+	}
+	return bOk;
+}
+
+void USaveSystemSubsystem::PublishReadSnapshot(USaveProfileContext& Ctx)
+{
+	if (!Ctx.CurrentSaveSystem) return;
+
+	// Shares the previous snapshot's clean payloads, so this copies only what changed since the last publish.
+	const FSaveReadSnapshotPtr Previous = Ctx.ReadSnapshots->Get();
+	Ctx.ReadSnapshots->Publish(Ctx.CurrentSaveSystem->MakeReadSnapshot(Previous.Get()));
+}
+
+USaveSystemSubsystem::FSaveWriteJob USaveSystemSubsystem::PrepareWriteJob(USaveSystem* SaveObj, const FString& Slot) const
+{
+	FSaveWriteJob Job;
+	Job.Slot = Slot;
+	Job.Owner = SaveObj;
+	Job.CompactionThresholdBytes = static_cast<int64>(JournalCompactionThresholdKB) * 1024;
+	Job.BackupGenerations = BackupGenerations;
+	Job.Encode.Codec = SlotCompression;
+	Job.Encode.Level = SlotCompressionLevel;
+	Job.WriteState = SaveObj->WriteState;
+
+	// A failed write may not be acknowledged yet; the worker's flag already tells.
+	if (SaveObj->WriteState->bJournalBroken.load(std::memory_order_acquire))
+	{
+		SaveObj->bNeedsFullWrite = true;
+	}
+
+	// Platform save systems only store whole saves (see SaveSlotStorage::UsesSlotFiles).
+	if (!bEnableSaveJournal || !SaveSlotStorage::UsesSlotFiles() || SaveObj->bNeedsFullWrite)
+	{
+		Job.Full = MakeShared<const FSaveSnapshot>(SaveObj->MakeSnapshot());
+		Job.NumChanges = SaveObj->ClearDirtyState();
+		return Job;
+	}
+
+	FSaveDelta Delta = SaveObj->MakeDelta();
+	Job.NumChanges = Delta.NumChanges();
+	if (!Delta.IsEmpty())
+	{
+		Job.Delta = MakeShared<const FSaveDelta>(MoveTemp(Delta));
+	}
+	return Job;
+}
+
+bool USaveSystemSubsystem::RunWriteJob(const FSaveWriteJob& Job, FSaveIoTimings* OutTimings)
+{
+	FSaveIoTimings Unused;
+	FSaveIoTimings& Timings = OutTimings ? *OutTimings : Unused;
+
+	const double LockStart = FPlatformTime::Seconds();
+	FScopeLock Lock(&SaveJournal::GetSlotLock(Job.Slot));
+	const double StartSeconds = FPlatformTime::Seconds();
+	Timings.LockWaitSeconds += StartSeconds - LockStart;
+
+	// Everything but encoding is file I/O.
+	double EncodeSeconds = 0.0;
+	ON_SCOPE_EXIT
+	{
+		Timings.SerializeSeconds += EncodeSeconds;
+		Timings.IoSeconds += FPlatformTime::Seconds() - StartSeconds - EncodeSeconds;
+	};
+
+	if (Job.Full.IsValid())
+	{
+		TArray<uint8> Bytes;
+		SaveSlotFormat::Write(*Job.Full, Bytes, Job.Encode);
+		EncodeSeconds = FPlatformTime::Seconds() - StartSeconds;
+		const bool bOk = SaveSlotStorage::WriteAtomic(Job.Slot, Bytes, Job.BackupGenerations);
+		if (bOk)
+		{
+			// The image already contains every journaled change.
+			SaveJournal::Discard(Job.Slot);
+			Timings.Bytes += Bytes.Num();
+		}
+		if (Job.WriteState.IsValid())
+		{
+			Job.WriteState->bJournalBroken.store(!bOk, std::memory_order_release);
+		}
+		return bOk;
+	}
+
+	if (Job.Delta.IsValid())
+	{
+		// An earlier record of this slot was lost: appending would replay on top of a gap. Failing sends the
+		// owner to a full image, which holds these changes too.
+		if (Job.WriteState.IsValid() && Job.WriteState->bJournalBroken.load(std::memory_order_acquire))
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] %s: not appending record %lld after a failed write; the next save writes a full image."),
+				*Job.Slot, Job.Delta->Sequence);
+			return false;
+		}
+
+		int64 RecordBytes = 0;
+		const int64 JournalSize = SaveJournal::Append(Job.Slot, *Job.Delta, &RecordBytes, &EncodeSeconds);
+		if (JournalSize == INDEX_NONE)
+		{
+			if (Job.WriteState.IsValid())
+			{
+				Job.WriteState->bJournalBroken.store(true, std::memory_order_release);
+			}
+			return false;
+		}
+		Timings.Bytes += RecordBytes;
+		if (Job.CompactionThresholdBytes > 0 && JournalSize > Job.CompactionThresholdBytes)
+		{
+			// Compaction failing doesn't lose data; the journal simply keeps growing until it succeeds.
+			int64 ImageBytes = 0;
+			double CompactEncodeSeconds = 0.0;
+			SaveJournal::Compact(Job.Slot, Job.BackupGenerations, Job.Encode, &ImageBytes, &CompactEncodeSeconds);
+			Timings.Bytes += ImageBytes;
+			EncodeSeconds += CompactEncodeSeconds;
+		}
+	}
+
+	// Nothing changed since the last save: nothing to write.
+	return true;
+}
+
+void USaveSystemSubsystem::AddWriteResults(FSaveStats& Stats, TConstArrayView<FSaveWriteJob> Jobs, const FSaveIoTimings& Timings)
+{
+	Stats.SerializeMs = ToMs(Timings.SerializeSeconds);
+	Stats.WriteMs = ToMs(Timings.IoSeconds);
+	Stats.QueueWaitMs += ToMs(Timings.LockWaitSeconds);
+	Stats.Bytes = Timings.Bytes;
+	Stats.bFullImage = Jobs.Num() > 0 && Jobs[0].Full.IsValid();
+	Stats.DirtyCount = 0;
+	for (const FSaveWriteJob& Job : Jobs)
+	{
+		Stats.DirtyCount += Job.NumChanges;
+	}
+}
+
+void USaveSystemSubsystem::RecordStats(FSaveStats& Stats)
+{
+	Stats.SessionSeconds = static_cast<float>(FPlatformTime::Seconds() - GStartTime);
+
+	if (Stats.Op == ESaveStatsOp::Save)
+	{
+		SaveStatsHistory.Add(Stats);
+
+		SET_FLOAT_STAT(STAT_FWSSave_SaveGatherMs, Stats.GatherMs);
+		SET_FLOAT_STAT(STAT_FWSSave_SaveSerializeMs, Stats.SerializeMs);
+		SET_FLOAT_STAT(STAT_FWSSave_SaveWriteMs, Stats.WriteMs);
+		SET_FLOAT_STAT(STAT_FWSSave_SaveQueueMs, Stats.QueueWaitMs);
+		SET_DWORD_STAT(STAT_FWSSave_SaveBytes, Stats.Bytes);
+		SET_DWORD_STAT(STAT_FWSSave_SaveDirty, Stats.DirtyCount);
+
+		CSV_CUSTOM_STAT(FWSSave, SaveGatherMs, Stats.GatherMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, SaveSerializeMs, Stats.SerializeMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, SaveWriteMs, Stats.WriteMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, SaveQueueWaitMs, Stats.QueueWaitMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, SaveKB, static_cast<float>(Stats.Bytes / 1024.0), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, SaveObjects, Stats.ObjectCount, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, SaveDirty, Stats.DirtyCount, ECsvCustomStatOp::Set);
+	}
+	else
+	{
+		LoadStatsHistory.Add(Stats);
+
+		SET_FLOAT_STAT(STAT_FWSSave_LoadGatherMs, Stats.GatherMs);
+		SET_FLOAT_STAT(STAT_FWSSave_LoadSerializeMs, Stats.SerializeMs);
+		SET_FLOAT_STAT(STAT_FWSSave_LoadReadMs, Stats.WriteMs);
+
+		CSV_CUSTOM_STAT(FWSSave, LoadApplyMs, Stats.GatherMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, LoadDecodeMs, Stats.SerializeMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, LoadReadMs, Stats.WriteMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, LoadQueueWaitMs, Stats.QueueWaitMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, LoadKB, static_cast<float>(Stats.Bytes / 1024.0), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(FWSSave, LoadObjects, Stats.ObjectCount, ECsvCustomStatOp::Set);
+	}
+	SET_DWORD_STAT(STAT_FWSSave_SlotObjects, Stats.SlotObjectCount);
+	CSV_CUSTOM_STAT(FWSSave, SlotObjects, Stats.SlotObjectCount, ECsvCustomStatOp::Set);
+	CSV_EVENT(FWSSave, TEXT("%s %s"), Stats.Op == ESaveStatsOp::Save ? TEXT("Save") : TEXT("Load"), *Stats.SlotName);
+
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] %s stats %s: gather=%.2fms serialize=%.2fms io=%.2fms queue=%.2fms frame=%.2fms/%d, %lld bytes, %d objects (%d dirty), %d in slot"),
+			Stats.Op == ESaveStatsOp::Save ? TEXT("Save") : TEXT("Load"), *Stats.SlotName, Stats.GatherMs, Stats.SerializeMs, Stats.WriteMs,
+			Stats.QueueWaitMs, Stats.MaxFrameMs, Stats.Frames, Stats.Bytes, Stats.ObjectCount, Stats.DirtyCount, Stats.SlotObjectCount);
+	}
+
+	OnSaveStats.Broadcast(Stats);
+}
+
+FSaveStatsSummary USaveSystemSubsystem::GetStatsSummary(ESaveStatsOp Op) const
+{
+	return GetStatsHistory(Op).Summarize();
+}
+
+void USaveSystemSubsystem::ResetStatsHistory()
+{
+	SaveStatsHistory.Reset();
+	LoadStatsHistory.Reset();
+}
+
+void USaveSystemSubsystem::AcknowledgeWriteJob(const FSaveWriteJob& Job, bool bOk)
+{
+	if (USaveSystem* SaveObj = Job.Owner.Get())
+	{
+		// A lost delta can't be re-sent; fall back to a full image next time.
+		SaveObj->bNeedsFullWrite = !bOk || (SaveObj->bNeedsFullWrite && !Job.Full.IsValid());
+	}
+}
+
+void USaveSystemSubsystem::BeginGather(USaveProfileContext& Ctx, FSaveGatherBatch& OutBatch)
+{
+	OutBatch.Reset();
+
+	TArray<UObject*> Objects;
+	RegisteredSaveables.GatherObjects(Objects);
+	OutBatch.Items.Reserve(Objects.Num());
+
+	const bool bFilterContext = Contexts.Num() > 1;
+	for (UObject* Obj : Objects)
+	{
+		// Split-screen: every player's objects go to their own profile.
+		if (bFilterContext && &GetContextFor(Obj) != &Ctx)
+		{
+			continue;
+		}
+
+		FSaveGatherBatch::FItem& Item = OutBatch.Items.AddDefaulted_GetRef();
+		Item.Object = Obj;
+
+		// Partitions are few (one per loaded level); a linear AddUnique beats hashing here.
+		const FName Partition = GetSavePartition(Obj);
+		if (!Partition.IsNone())
+		{
+			Item.Target = OutBatch.Partitions.AddUnique(Partition);
+		}
+	}
+
+	// Runtime-spawned actors the primary profile respawns on load, saveable or not.
+	if (Ctx.LocalUserNum == 0)
+	{
+		CaptureSpawnRecords(Ctx, nullptr, &OutBatch.Partitions);
+	}
+
+	// Chunks are read now, so no slice ever waits on disk.
+	const FDateTime Now = FDateTime::Now();
+	Ctx.CurrentSaveSystem->SaveTimestamp = Now;
+	for (const FName& Partition : OutBatch.Partitions)
+	{
+		USaveSystem* Chunk = FindOrLoadChunk(Ctx, Partition);
+		Chunk->SaveVersion = CurrentSaveVersion;
+		Chunk->SaveTimestamp = Now;
+	}
+}
+
+bool USaveSystemSubsystem::RunGather(USaveProfileContext& Ctx, FSaveGatherBatch& Batch, double BudgetSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FWSSave_Gather);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	int32 NumGathered = 0;
+	while (!Batch.IsDone())
+	{
+		const FSaveGatherBatch::FItem& Item = Batch.Items[Batch.Cursor++];
+
+		// Objects destroyed since BeginGather are skipped, and so are those whose level streamed out mid-gather
+		// (HandleLevelRemoved already captured them into the flushed chunk).
+		UObject* Obj = Item.Object.Get();
+		USaveSystem* Target = Item.Target == INDEX_NONE ? Ctx.CurrentSaveSystem : Ctx.ResidentChunks.FindRef(Batch.Partitions[Item.Target]);
+		if (Obj && Target)
+		{
+			Target->SaveObject(Obj);
+			++NumGathered;
+		}
+
+		if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+	INC_DWORD_STAT_BY(STAT_FWSSave_GatherObjects, NumGathered);
+
+	const double FrameSeconds = FPlatformTime::Seconds() - StartSeconds;
+	++Batch.Frames;
+	Batch.TotalSeconds += FrameSeconds;
+	Batch.MaxFrameSeconds = FMath::Max(Batch.MaxFrameSeconds, FrameSeconds);
+	Batch.LastFrameSeconds = FrameSeconds;
+	return Batch.IsDone();
+}
+
+void USaveSystemSubsystem::PrepareGatheredJobs(USaveProfileContext& Ctx, const FSaveGatherBatch& Batch, TArray<FSaveWriteJob>& OutJobs)
+{
+	// After SaveData, so payloads created by this gather are stamped before their actor can disappear.
+	TrackReachability(Ctx, nullptr);
+	RetryFailedChunkFlushes(Ctx);
+
+	PublishReadSnapshot(Ctx);
+	OutJobs.Add(PrepareWriteJob(Ctx.CurrentSaveSystem, Ctx.SaveSlotName));
+
+	// A chunk that streamed out mid-gather has been flushed already.
+	for (const FName& Partition : Batch.Partitions)
+	{
+		if (USaveSystem* Chunk = Ctx.ResidentChunks.FindRef(Partition))
+		{
+			OutJobs.Add(PrepareWriteJob(Chunk, SaveSlotStorage::GetChunkSlot(Ctx.SaveSlotName, Partition)));
+		}
+	}
+}
+
+int32 USaveSystemSubsystem::GatherAndPrepareJobs(USaveProfileContext& Ctx, TArray<FSaveWriteJob>& OutJobs)
+{
+	FSaveGatherBatch Batch;
+	BeginGather(Ctx, Batch);
+	RunGather(Ctx, Batch, 0.0);
+	PrepareGatheredJobs(Ctx, Batch, OutJobs);
+
+	LastSaveGatherFrames = Batch.Frames;
+	LastSaveGatherTotalMs = static_cast<float>(Batch.TotalSeconds * 1000.0);
+	return Batch.Items.Num();
+}
+
+FString USaveSystemSubsystem::FSaveWriteJob::Describe() const
+{
+	if (Full.IsValid())  return TEXT("full image");
+	if (Delta.IsValid()) return FString::Printf(TEXT("journal delta: %d changes"), Delta->NumChanges());
+	return TEXT("no changes");
+}
+
+/* ---------- Level partitions ---------- */
+
+namespace
+{
+	/** Level of the actor that owns a saveable (the saveable itself or its outer actor). */
+	const ULevel* GetSaveLevel(const UObject* Obj)
+	{
+		const AActor* Actor = Cast<AActor>(Obj);
+		if (!Actor && Obj)
+		{
+			Actor = Obj->GetTypedOuter<AActor>();
+		}
+		return Actor ? Actor->GetLevel() : nullptr;
+	}
+}
+
+FName USaveSystemSubsystem::GetLevelPartition(const ULevel* Level) const
+{
+	if (!bPartitionStreamedLevels || !Level || Level->IsPersistentLevel())
+	{
+		return NAME_None;
+	}
+	if (const FName* Cached = LevelPartitionCache.Find(TObjectKey<ULevel>(Level)))
+	{
+		return *Cached;
+	}
+
+	// Streamed sublevels and World Partition cells are both ULevels in their own (deterministically named) package.
+	// PIE prefixes the package per instance; strip it so PIE and packaged builds share chunks.
+	const FName Partition(*UWorld::RemovePIEPrefix(Level->GetPackage()->GetName()));
+	LevelPartitionCache.Add(TObjectKey<ULevel>(Level), Partition);
+	return Partition;
+}
+
+FName USaveSystemSubsystem::GetSavePartition(const UObject* Obj) const
+{
+	return GetLevelPartition(GetSaveLevel(Obj));
+}
+
+void USaveSystemSubsystem::GatherRefsByPartition(const USaveProfileContext& Ctx, TArray<FSaveableRef>& OutMain, TMap<FName, TArray<FSaveableRef>>& OutChunks) const
+{
+	const bool bFilterContext = Contexts.Num() > 1;
+	for (const FSaveableRef& Ref : RegisteredSaveables.GetRefs())
+	{
+		const UObject* Obj = Ref.Object.Get();
+		if (!Obj || (bFilterContext && &GetContextFor(Obj) != &Ctx)) continue;
+
+		const FName Partition = GetSavePartition(Obj);
+		(Partition.IsNone() ? OutMain : OutChunks.FindOrAdd(Partition)).Add(Ref);
+	}
+}
+
+USaveSystem* USaveSystemSubsystem::FindOrLoadChunk(USaveProfileContext& Ctx, FName Partition)
+{
+	if (USaveSystem* const* Resident = Ctx.ResidentChunks.Find(Partition))
+	{
+		return *Resident;
+	}
+
+	// Streamed out and back in before its flush was acknowledged: the in-memory chunk is the newest state.
+	const FString ChunkSlot = SaveSlotStorage::GetChunkSlot(Ctx.SaveSlotName, Partition);
+	USaveSystem* Flushing = nullptr;
+	if (Ctx.FlushingChunks.RemoveAndCopyValue(ChunkSlot, Flushing) && Flushing)
+	{
+		Ctx.FailedChunkFlushes.Remove(ChunkSlot);
+		Ctx.ResidentChunks.Add(Partition, Flushing);
+		return Flushing;
+	}
+
+	// A queued write of the slot (a save that still gathered the chunk) lands before it is read back.
+	Ctx.PendingWriteTask.Wait();
+
+	USaveSystem* Chunk = SaveSlotStorage::Exists(ChunkSlot) ? ReadSlot(ChunkSlot) : nullptr;
+	if (!Chunk)
+	{
+		Chunk = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+		Chunk->SaveVersion = CurrentSaveVersion;
+	}
+	Ctx.ResidentChunks.Add(Partition, Chunk);
+	return Chunk;
+}
+
+void USaveSystemSubsystem::MigrateToChunk(USaveProfileContext& Ctx, USaveSystem& Chunk, TConstArrayView<FSaveableRef> Refs)
+{
+	USaveSystem* CurrentSaveSystem = Ctx.CurrentSaveSystem;
 	if (!CurrentSaveSystem) return;
 
-	CurrentSaveSystem->SetField(ObjectId, Key, NewValue);
+	int32 NumMoved = 0;
+	for (const FSaveableRef& Ref : Refs)
+	{
+		const UObject* Obj = Ref.Object.Get();
+		const USaveIdComponent* SaveId = Ref.SaveId.Get();
+		if (!Obj || Chunk.FindPayloadFor(Obj, SaveId))
+		{
+			continue;
+		}
+
+		// Same key preference as FindPayloadFor: GUID first, then object name.
+		if (SaveId && SaveId->HasGuid())
+		{
+			if (const FSaveObjectData* Legacy = CurrentSaveSystem->FindObjectByGuid(SaveId->SaveGuid))
+			{
+				FSaveObjectData& Moved = Chunk.GetOrCreateObjectByGuid(SaveId->SaveGuid);
+				Moved = *Legacy;
+				Moved.MarkDirty();
+				CurrentSaveSystem->RemoveObjectByGuid(SaveId->SaveGuid);
+				++NumMoved;
+				continue;
+			}
+		}
+		if (const FSaveObjectData* Legacy = CurrentSaveSystem->FindObject(Obj->GetFName()))
+		{
+			FSaveObjectData& Moved = Chunk.GetOrCreateObject(Obj->GetFName());
+			Moved = *Legacy;
+			Moved.MarkDirty();
+			CurrentSaveSystem->RemoveObject(Obj->GetFName());
+			++NumMoved;
+		}
+	}
+
+	if (NumMoved > 0 && bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Moved %d objects from slot %s into their level chunk."), NumMoved, *Ctx.SaveSlotName);
+	}
+}
+
+void USaveSystemSubsystem::ApplyChunk(USaveProfileContext& Ctx, FName Partition, TConstArrayView<FSaveableRef> Refs)
+{
+	USaveSystem* Chunk = FindOrLoadChunk(Ctx, Partition);
+	MigrateToChunk(Ctx, *Chunk, Refs);
+	if (Ctx.LocalUserNum == 0)
+	{
+		ApplyWorldState(Ctx, *Chunk, Partition);
+	}
+
+	FSaveLoadBatch Batch;
+	Chunk->ResolveLoadBatch(Refs, Batch);
+	Chunk->DispatchLoadBatch(Batch, 0.0);
+
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Applied chunk %s (%d objects, %d resident chunks)."),
+			*Partition.ToString(), Batch.Items.Num(), Ctx.ResidentChunks.Num());
+	}
+}
+
+void USaveSystemSubsystem::HandleLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld()) return;
+
+	const FName Partition = GetLevelPartition(Level);
+	if (Partition.IsNone()) return;
+
+	// The level's actors have run BeginPlay (and registered) by the time it is added to the world.
+	TArray<FSaveableRef> Refs;
+	for (const FSaveableRef& Ref : RegisteredSaveables.GetRefs())
+	{
+		if (GetSaveLevel(Ref.Object.Get()) == Level)
+		{
+			Refs.Add(Ref);
+		}
+	}
+
+	// Each profile applies its own chunk of the level to the objects that save into it.
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		// While an async load is still reading, CurrentSaveSystem may be the previous profile's; the load applies this level when it lands.
+		USaveProfileContext& Ctx = *Pair.Value;
+		if (!Ctx.CurrentSaveSystem || Ctx.PendingRead.IsValid()) continue;
+
+		TArray<FSaveableRef> CtxRefs;
+		for (const FSaveableRef& Ref : Refs)
+		{
+			const UObject* Obj = Ref.Object.Get();
+			if (Obj && &GetContextFor(Obj) == &Ctx)
+			{
+				CtxRefs.Add(Ref);
+			}
+		}
+		// The primary profile owns the level's world state, so it loads the chunk even with nothing registered yet.
+		if (CtxRefs.Num() > 0 || Pair.Key == 0)
+		{
+			ApplyChunk(Ctx, Partition, CtxRefs);
+		}
+	}
+}
+
+void USaveSystemSubsystem::HandleLevelRemoved(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld()) return;
+
+	const FName Partition = GetLevelPartition(Level);
+	LevelPartitionCache.Remove(TObjectKey<ULevel>(Level));
+	if (Partition.IsNone()) return;
+
+	// Actors are still alive here (pre-removal): capture their state, then drop the chunk from memory.
+	TArray<UObject*> Objects;
+	for (const FSaveableRef& Ref : RegisteredSaveables.GetRefs())
+	{
+		UObject* Obj = Ref.Object.Get();
+		if (Obj && GetSaveLevel(Obj) == Level)
+		{
+			Objects.Add(Obj);
+		}
+	}
+
+	const bool bDebug = bPrintDebugOutput;
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		USaveProfileContext& Ctx = *Pair.Value;
+		USaveSystem* Chunk = Ctx.CurrentSaveSystem ? Ctx.ResidentChunks.FindRef(Partition) : nullptr;
+		if (!Chunk) continue;
+
+		TArray<UObject*> CtxObjects;
+		for (UObject* Obj : Objects)
+		{
+			if (&GetContextFor(Obj) == &Ctx)
+			{
+				CtxObjects.Add(Obj);
+			}
+		}
+		if (Pair.Key == 0)
+		{
+			CaptureSpawnRecords(Ctx, Level, nullptr);
+		}
+		Chunk->SaveVersion = CurrentSaveVersion;
+		Chunk->SaveAllData(CtxObjects);
+		TrackReachability(Ctx, Level);
+		Ctx.ResidentChunks.Remove(Partition);
+		FlushChunk(Ctx, SaveSlotStorage::GetChunkSlot(Ctx.SaveSlotName, Partition), Chunk);
+	}
+}
+
+void USaveSystemSubsystem::FlushChunk(USaveProfileContext& Ctx, const FString& ChunkSlot, USaveSystem* Chunk)
+{
+	// The chunk's dirty state moves into the job here, so it stays in memory until the write is known to have landed.
+	Ctx.FlushingChunks.Add(ChunkSlot, Chunk);
+	Ctx.FailedChunkFlushes.Remove(ChunkSlot);
+	const FSaveWriteJob Job = PrepareWriteJob(Chunk, ChunkSlot);
+
+	const bool bDebug = bPrintDebugOutput;
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	TWeakObjectPtr<USaveProfileContext> WeakCtx(&Ctx);
+	Ctx.PendingWriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, WeakCtx, Job, bDebug]()
+	{
+		const bool bOk = RunWriteJob(Job);
+		if (bOk && bDebug)
+		{
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Flushed chunk %s (%s)."), *Job.Slot, *Job.Describe());
+		}
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakCtx, Job, bOk]()
+		{
+			USaveSystemSubsystem* Self = WeakThis.Get();
+			USaveProfileContext* Context = WeakCtx.Get();
+			if (Self && Context)
+			{
+				Self->OnChunkFlushed(*Context, Job, bOk);
+			}
+			else
+			{
+				AcknowledgeWriteJob(Job, bOk);
+			}
+		});
+	}, UE::Tasks::Prerequisites(Ctx.PendingWriteTask));
+}
+
+void USaveSystemSubsystem::FlushResidentChunks(USaveProfileContext& Ctx)
+{
+	for (const TPair<FName, USaveSystem*>& Pair : Ctx.ResidentChunks)
+	{
+		if (Pair.Value && Pair.Value->HasUnsavedChanges())
+		{
+			FlushChunk(Ctx, SaveSlotStorage::GetChunkSlot(Ctx.SaveSlotName, Pair.Key), Pair.Value);
+		}
+	}
+	Ctx.ResidentChunks.Reset();
+}
+
+void USaveSystemSubsystem::OnChunkFlushed(USaveProfileContext& Ctx, const FSaveWriteJob& Job, bool bOk)
+{
+	AcknowledgeWriteJob(Job, bOk);
+
+	// A level that streamed back in meanwhile has taken the chunk back into ResidentChunks; it saves from there.
+	USaveSystem* const* Flushing = Ctx.FlushingChunks.Find(Job.Slot);
+	if (!Flushing || *Flushing != Job.Owner.Get())
+	{
+		return;
+	}
+	if (bOk)
+	{
+		Ctx.FlushingChunks.Remove(Job.Slot);
+		return;
+	}
+
+	// Its changes only exist in memory now; AcknowledgeWriteJob made the retry a full image.
+	UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Flushing chunk %s failed; keeping it in memory and retrying with the next save."), *Job.Slot);
+	Ctx.FailedChunkFlushes.Add(Job.Slot);
+	RequestSave(Ctx, /*bAsync*/true, ESavePriority::Background);
+}
+
+void USaveSystemSubsystem::RetryFailedChunkFlushes(USaveProfileContext& Ctx)
+{
+	const TArray<FString> Failed = Ctx.FailedChunkFlushes.Array();
+	for (const FString& ChunkSlot : Failed)
+	{
+		if (USaveSystem* Chunk = Ctx.FlushingChunks.FindRef(ChunkSlot))
+		{
+			FlushChunk(Ctx, ChunkSlot, Chunk);
+		}
+		else
+		{
+			Ctx.FailedChunkFlushes.Remove(ChunkSlot);
+		}
+	}
+}
+
+void USaveSystemSubsystem::FinishChunkFlushes(USaveProfileContext& Ctx)
+{
+	// The queued acknowledgements won't run any more, but the workers' flags already tell which writes failed.
+	for (const TPair<FString, USaveSystem*>& Pair : Ctx.FlushingChunks)
+	{
+		USaveSystem* Chunk = Pair.Value;
+		if (!Chunk || !Chunk->WriteState->bJournalBroken.load(std::memory_order_acquire)) continue;
+
+		if (!RunWriteJob(PrepareWriteJob(Chunk, Pair.Key)))
+		{
+			UE_LOG(LogSaveSystem, Error, TEXT("[SaveSystemSubsystem] Chunk %s still can't be written; its changes since its last successful write are lost."), *Pair.Key);
+		}
+	}
+	Ctx.FlushingChunks.Reset();
+	Ctx.FailedChunkFlushes.Reset();
+}
+
+/* ---------- World state ---------- */
+
+namespace
+{
+	/** Fields of a GUID payload that aren't the actor's own (ISaveable) data. */
+	static const FName SpawnClassKey(TEXT("__SpawnClass"));
+	static const FName SpawnTransformKey(TEXT("__SpawnTransform"));
+	static const FName DestroyedKey(TEXT("__Destroyed"));
+
+	TArray<uint8> EncodeTransform(FTransform Transform)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar(Bytes);
+		Ar << Transform;
+		return Bytes;
+	}
+
+	bool DecodeTransform(const TArray<uint8>* Bytes, FTransform& OutTransform)
+	{
+		if (!Bytes || Bytes->Num() == 0) return false;
+		FMemoryReader Ar(*Bytes);
+		Ar << OutTransform;
+		return !Ar.IsError();
+	}
+}
+
+void USaveSystemSubsystem::HandleSaveIdDestroyed(const USaveIdComponent& SaveId)
+{
+	if (bApplyingWorldState || !SaveId.HasGuid()) return;
+
+	const bool bPlaced = SaveId.IsPlacedInLevel();
+	if (bPlaced ? !SaveId.bPersistDestruction : !SaveId.bRespawnOnLoad) return;
+
+	// World state lives in the primary profile. While its async load is still reading, the save object is about to be replaced.
+	USaveProfileContext* Ctx = FindContext(0);
+	if (!Ctx || !Ctx->CurrentSaveSystem || Ctx->PendingRead.IsValid()) return;
+
+	const FName Partition = GetSavePartition(SaveId.GetOwner());
+	USaveSystem* Save = Partition.IsNone() ? Ctx->CurrentSaveSystem : FindOrLoadChunk(*Ctx, Partition);
+
+	if (bPlaced)
+	{
+		// The actor's own data is obsolete; the marker is all a load needs, and keeps the journal record small.
+		FSaveObjectData& Data = Save->GetOrCreateObjectByGuid(SaveId.SaveGuid);
+		Data.Fields.Reset();
+		Data.SavedFields.Reset();
+		Data.BinaryPayload.Reset();
+		Data.SetBool(DestroyedKey, true);
+		Data.MarkDirty();
+
+		FSaveSessionLog SessionLog;
+		if (StaleRetentionSessions > 0 && SaveReachability::ReadLog(*Save, SessionLog))
+		{
+			SaveReachability::MarkSeen(Data, SaveReachability::GetLevelId(SaveId.GetOwner()->GetLevel()), SessionLog);
+		}
+	}
+	else
+	{
+		Save->RemoveObjectByGuid(SaveId.SaveGuid);
+	}
+
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] %s destroyed: %s."),
+			*GetNameSafe(SaveId.GetOwner()), bPlaced ? TEXT("tombstone recorded") : TEXT("no longer respawned"));
+	}
+}
+
+void USaveSystemSubsystem::CaptureSpawnRecords(USaveProfileContext& Ctx, const ULevel* OnlyLevel, TArray<FName>* OutPartitions)
+{
+	const USaveIdRegistry* Registry = USaveIdRegistry::Get(this);
+	if (!Registry || !Ctx.CurrentSaveSystem) return;
+
+	for (const TWeakObjectPtr<USaveIdComponent>& Weak : Registry->GetRespawnable())
+	{
+		const USaveIdComponent* SaveId = Weak.Get();
+		const AActor* Actor = SaveId ? SaveId->GetOwner() : nullptr;
+		if (!IsValid(Actor) || !SaveId->HasGuid() || SaveId->IsPlacedInLevel() || (OnlyLevel && Actor->GetLevel() != OnlyLevel))
+		{
+			continue;
+		}
+
+		const FName Partition = GetSavePartition(Actor);
+		USaveSystem* Target = Partition.IsNone() ? Ctx.CurrentSaveSystem : FindOrLoadChunk(Ctx, Partition);
+		if (!Partition.IsNone() && OutPartitions)
+		{
+			OutPartitions->AddUnique(Partition);
+		}
+
+		// Unchanged values don't dirty the payload, so actors that stayed put cost nothing in the journal.
+		FSaveObjectData& Data = Target->GetOrCreateObjectByGuid(SaveId->SaveGuid);
+		Data.SetField(SpawnClassKey, Actor->GetClass()->GetPathName());
+		Data.SetBlob(SpawnTransformKey, EncodeTransform(Actor->GetActorTransform()));
+	}
+}
+
+void USaveSystemSubsystem::ApplyWorldState(USaveProfileContext& Ctx, USaveSystem& Save, FName Partition)
+{
+	UWorld* World = GetWorld();
+	const USaveIdRegistry* Registry = USaveIdRegistry::Get(this);
+	if (!World || !Registry) return;
+
+	// The profile slot covers the persistent level (and every level with partitions off); a chunk covers its own level.
+	TArray<ULevel*, TInlineAllocator<8>> Levels;
+	for (ULevel* Level : World->GetLevels())
+	{
+		if (Level && GetLevelPartition(Level) == Partition)
+		{
+			Levels.Add(Level);
+		}
+	}
+
+	// Tombstones: a registry hit plus a payload lookup per placed actor; only actors with a payload decode anything.
+	// Their actor still exists in the level, so they count as seen and never age out of the save.
+	FSaveSessionLog SessionLog;
+	const bool bTrackSeen = StaleRetentionSessions > 0 && SaveReachability::ReadLog(Save, SessionLog);
+	TArray<AActor*> Destroyed;
+	for (const ULevel* Level : Levels)
+	{
+		const FName LevelId = bTrackSeen ? SaveReachability::GetLevelId(Level) : NAME_None;
+		for (AActor* Actor : Level->Actors)
+		{
+			const USaveIdComponent* SaveId = Registry->FindComponent(Actor);
+			if (!SaveId || !SaveId->bPersistDestruction || !SaveId->IsPlacedInLevel()) continue;
+
+			const FSaveObjectData* Data = Save.FindObjectByGuid(SaveId->SaveGuid);
+			bool bDestroyed = false;
+			if (Data && Data->GetBool(DestroyedKey, bDestroyed) && bDestroyed)
+			{
+				if (bTrackSeen)
+				{
+					SaveReachability::MarkSeen(Save.GetOrCreateObjectByGuid(SaveId->SaveGuid), LevelId, SessionLog);
+				}
+				Destroyed.Add(Actor);
+			}
+		}
+	}
+	{
+		TGuardValue<bool> ApplyingScope(bApplyingWorldState, true);
+		for (AActor* Actor : Destroyed)
+		{
+			Actor->Destroy();
+		}
+	}
+
+	// Respawns: saved GUIDs no actor claims that carry a spawn record (tombstones and other levels' actors don't).
+	TArray<FGuid> Missing;
+	Registry->FindMissingGuids(&Save, Missing);
+
+	FSaveRespawnBatch& Batch = PendingRespawn;
+	TMap<FSoftClassPath, int32> ClassIndex;
+	for (int32 i = 0; i < Batch.Classes.Num(); ++i)
+	{
+		ClassIndex.Add(Batch.Classes[i], i);
+	}
+
+	int32 NumQueued = 0;
+	ULevel* SpawnLevel = Partition.IsNone() || Levels.Num() == 0 ? nullptr : Levels[0];
+	for (const FGuid& Guid : Missing)
+	{
+		const FSaveObjectData* Data = Save.FindObjectByGuid(Guid);
+		FString ClassPath;
+		if (!Data || !Data->GetField(SpawnClassKey, ClassPath)) continue;
+
+		FSaveRespawnBatch::FItem& Item = Batch.Items.AddDefaulted_GetRef();
+		Item.Guid = Guid;
+		DecodeTransform(Data->GetBlob(SpawnTransformKey), Item.Transform);
+		Item.Source = &Save;
+		Item.Partition = Partition;
+		Item.Level = SpawnLevel;
+
+		const FSoftClassPath Class(ClassPath);
+		if (const int32* Found = ClassIndex.Find(Class))
+		{
+			Item.Class = *Found;
+		}
+		else
+		{
+			Item.Class = Batch.Classes.Add(Class);
+			ClassIndex.Add(Class, Item.Class);
+		}
+		++NumQueued;
+	}
+
+	if (bPrintDebugOutput && (Destroyed.Num() > 0 || NumQueued > 0))
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] World state of %s%s%s: %d tombstoned actors destroyed, %d actors to respawn."),
+			*Ctx.SaveSlotName, Partition.IsNone() ? TEXT("") : TEXT("@"), Partition.IsNone() ? TEXT("") : *Partition.ToString(),
+			Destroyed.Num(), NumQueued);
+	}
+
+	if (NumQueued > 0)
+	{
+		Batch.World = World;
+		Batch.Slot = Ctx.SaveSlotName;
+		StartRespawn();
+	}
+}
+
+void USaveSystemSubsystem::StartRespawn()
+{
+	FSaveRespawnBatch& Batch = PendingRespawn;
+
+	// Grouped by class: actors of one class spawn back to back, and a class that is still loading holds up only the tail.
+	MakeArrayView(Batch.Items).Slice(Batch.Cursor, Batch.Items.Num() - Batch.Cursor).StableSort(
+		[](const FSaveRespawnBatch::FItem& A, const FSaveRespawnBatch::FItem& B) { return A.Class < B.Class; });
+
+	// Only the class load (or the next slice) resumes the batch, never both.
+	if (UWorld* World = GetWorld(); World && RespawnSliceHandle.IsValid())
+	{
+		World->GetTimerManager().ClearTimer(RespawnSliceHandle);
+	}
+	RespawnSliceHandle.Invalidate();
+
+	if (!UAssetManager::IsInitialized())
+	{
+		// Classes load synchronously as their group comes up.
+		ContinueRespawn();
+		return;
+	}
+
+	// One request for every class of the batch: loaded ones are done at once, the others stream in off the game thread.
+	TArray<FSoftObjectPath> Paths(Batch.Classes);
+	const TSharedPtr<FStreamableHandle> Previous = Batch.ClassLoad;
+	Batch.ClassLoad = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths),
+		FStreamableDelegate::CreateUObject(this, &USaveSystemSubsystem::ContinueRespawn), FStreamableManager::AsyncLoadHighPriority);
+	if (Previous.IsValid())
+	{
+		Previous->CancelHandle();
+	}
+	if (!Batch.ClassLoad.IsValid())
+	{
+		ContinueRespawn();
+	}
+}
+
+void USaveSystemSubsystem::ContinueRespawn()
+{
+	RespawnSliceHandle.Invalidate();
+
+	FSaveRespawnBatch& Batch = PendingRespawn;
+	UWorld* World = GetWorld();
+	if (Batch.Items.Num() == 0) return;
+	if (!World || Batch.World.Get() != World)
+	{
+		CancelRespawn();
+		return;
+	}
+	// Called back again when the classes are in.
+	if (Batch.ClassLoad.IsValid() && Batch.ClassLoad->IsLoadingInProgress())
+	{
+		return;
+	}
+
+	USaveProfileContext& Primary = GetPrimary();
+	const USaveIdRegistry* Registry = USaveIdRegistry::Get(this);
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double BudgetSeconds = RespawnBudgetMsPerFrame / 1000.0;
+	while (!Batch.IsDone())
+	{
+		const FSaveRespawnBatch::FItem Item = Batch.Items[Batch.Cursor++];
+
+		// Skipped: its save object was replaced or its level streamed out, or something spawned the actor meanwhile.
+		USaveSystem* Source = Item.Source.Get();
+		USaveSystem* Current = Item.Partition.IsNone() ? Primary.CurrentSaveSystem : Primary.ResidentChunks.FindRef(Item.Partition);
+		if (!Source || Source != Current || (!Item.Partition.IsNone() && !Item.Level.IsValid()) || (Registry && Registry->FindComponent(Item.Guid)))
+		{
+			continue;
+		}
+
+		UClass* Class = Batch.Classes[Item.Class].TryLoadClass<AActor>();
+		if (!Class)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Can't respawn %s: class %s not found."),
+				*Item.Guid.ToString(), *Batch.Classes[Item.Class].ToString());
+			continue;
+		}
+
+		// Deferred, so a native SaveId carries the saved GUID before the actor registers and runs BeginPlay.
+		FActorSpawnParameters Params;
+		Params.bDeferConstruction = true;
+		Params.OverrideLevel = Item.Level.Get();
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AActor* Actor = World->SpawnActor(Class, &Item.Transform, Params);
+		if (!Actor) continue;
+
+		USaveIdComponent* SaveId = Actor->FindComponentByClass<USaveIdComponent>();
+		if (SaveId)
+		{
+			SaveId->SetSaveGuid(Item.Guid);
+		}
+		Actor->FinishSpawning(Item.Transform);
+
+		// Blueprint-added components only exist after construction; re-keyed from the GUID they just generated.
+		if (!SaveId)
+		{
+			SaveId = Actor->FindComponentByClass<USaveIdComponent>();
+		}
+		if (!SaveId)
+		{
+			SaveId = NewObject<USaveIdComponent>(Actor, USaveIdComponent::StaticClass(), TEXT("SaveIdComponent"));
+			SaveId->bRespawnOnLoad = true;
+			SaveId->SaveGuid = Item.Guid;
+			SaveId->RegisterComponent();
+		}
+		SaveId->SetSaveGuid(Item.Guid);
+
+		if (Actor->Implements<USaveable>())
+		{
+			const FSaveableRef Ref = FSaveableRef::Make(Actor);
+			FSaveLoadBatch Load;
+			Source->ResolveLoadBatch(MakeArrayView(&Ref, 1), Load);
+			Source->DispatchLoadBatch(Load, 0.0);
+		}
+		++Batch.NumSpawned;
+
+		if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	if (!Batch.IsDone())
+	{
+		RespawnSliceHandle = World->GetTimerManager().SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &USaveSystemSubsystem::ContinueRespawn));
+		return;
+	}
+
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Respawned %d of %d actors of %s (%d classes)."),
+			Batch.NumSpawned, Batch.Items.Num(), *Batch.Slot, Batch.Classes.Num());
+	}
+	const FString Slot = Batch.Slot;
+	const int32 NumSpawned = Batch.NumSpawned;
+	Batch.Reset();
+	OnRespawnFinished.Broadcast(Slot, NumSpawned);
+}
+
+void USaveSystemSubsystem::CancelRespawn()
+{
+	if (RespawnSliceHandle.IsValid())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(RespawnSliceHandle);
+		}
+		RespawnSliceHandle.Invalidate();
+	}
+	if (PendingRespawn.ClassLoad.IsValid())
+	{
+		PendingRespawn.ClassLoad->CancelHandle();
+	}
+	PendingRespawn.Reset();
+}
+
+/* ---------- Compaction ---------- */
+
+void USaveSystemSubsystem::TrackReachability(USaveProfileContext& Ctx, const ULevel* OnlyLevel)
+{
+	UWorld* World = GetWorld();
+	const USaveIdRegistry* Registry = USaveIdRegistry::Get(this);
+	if (StaleRetentionSessions <= 0 || !World || !Registry || !Ctx.CurrentSaveSystem) return;
+
+	// Loaded levels and the save object holding each one's payloads; every level counts the session, actors or not.
+	struct FLevelTarget
+	{
+		FName LevelId;
+		USaveSystem* Save = nullptr;
+	};
+	TMap<const ULevel*, FLevelTarget> Targets;
+	TMap<USaveSystem*, TArray<FName>> LevelIdsBySave;
+	for (const ULevel* Level : World->GetLevels())
+	{
+		if (!Level || (OnlyLevel && Level != OnlyLevel)) continue;
+
+		const FName Partition = GetLevelPartition(Level);
+		USaveSystem* Save = Partition.IsNone() ? Ctx.CurrentSaveSystem : Ctx.ResidentChunks.FindRef(Partition);
+		if (!Save) continue;
+
+		FLevelTarget& Target = Targets.Add(Level);
+		Target.LevelId = SaveReachability::GetLevelId(Level);
+		Target.Save = Save;
+		LevelIdsBySave.FindOrAdd(Save).Add(Target.LevelId);
+	}
+
+	TMap<USaveSystem*, FSaveSessionLog> Logs;
+	for (const TPair<USaveSystem*, TArray<FName>>& Pair : LevelIdsBySave)
+	{
+		SaveReachability::TouchLevels(*Pair.Key, Pair.Value, Logs.Add(Pair.Key));
+	}
+
+	// Hash lookups per live SaveId; a stamp only dirties its payload on the first save of a session.
+	for (const TPair<FGuid, TWeakObjectPtr<USaveIdComponent>>& Pair : Registry->GetComponents())
+	{
+		const USaveIdComponent* SaveId = Pair.Value.Get();
+		const AActor* Actor = SaveId ? SaveId->GetOwner() : nullptr;
+		const FLevelTarget* Target = Actor ? Targets.Find(Actor->GetLevel()) : nullptr;
+		if (Target && Target->Save->ContainsGuid(Pair.Key))
+		{
+			SaveReachability::MarkSeen(Target->Save->GetOrCreateObjectByGuid(Pair.Key), Target->LevelId, Logs.FindChecked(Target->Save));
+		}
+	}
+}
+
+void USaveSystemSubsystem::CompactSaveData()
+{
+	if (StaleRetentionSessions <= 0) return;
+
+	// Chunks of unloaded levels are left alone: their levels don't count sessions, so nothing in them can age.
+	Compaction.Reset();
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		const USaveProfileContext& Ctx = *Pair.Value;
+		if (!Ctx.CurrentSaveSystem || Ctx.IsLoadInProgress()) continue;
+
+		TArray<USaveSystem*, TInlineAllocator<8>> Saves;
+		Saves.Add(Ctx.CurrentSaveSystem);
+		for (const TPair<FName, USaveSystem*>& Chunk : Ctx.ResidentChunks)
+		{
+			Saves.Add(Chunk.Value);
+		}
+		for (USaveSystem* Save : Saves)
+		{
+			FSaveCompactionPass::FTarget& Target = Compaction.Targets.AddDefaulted_GetRef();
+			Target.LocalUserNum = Pair.Key;
+			Target.Save = Save;
+			SaveReachability::ReadLog(*Save, Target.Log);
+			Save->GetSavedGuids(Target.Guids);
+		}
+	}
+	Compaction.Stats.SaveObjects = Compaction.Targets.Num();
+
+	if (!CompactionTickHandle.IsValid())
+	{
+		CompactionTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USaveSystemSubsystem::TickCompaction));
+	}
+}
+
+bool USaveSystemSubsystem::TickCompaction(float DeltaTime)
+{
+	const USaveIdRegistry* Registry = USaveIdRegistry::Get(this);
+	FSaveCompactionPass& Pass = Compaction;
+	FSaveCompactionStats& Stats = Pass.Stats;
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double BudgetSeconds = CompactionBudgetMsPerFrame / 1000.0;
+	while (!Pass.IsDone())
+	{
+		FSaveCompactionPass::FTarget& Target = Pass.Targets[Pass.Current];
+		const USaveProfileContext* Ctx = FindContext(Target.LocalUserNum);
+		USaveSystem* Save = Target.Save.Get();
+
+		// A load replaced the save object (or is about to): whatever it held is gone or re-read anyway.
+		if (!Save || !Ctx || Ctx->IsLoadInProgress() || Target.Cursor >= Target.Guids.Num())
+		{
+			++Pass.Current;
+			continue;
+		}
+
+		const FGuid& Guid = Target.Guids[Target.Cursor++];
+		++Stats.Checked;
+
+		// A registered actor is alive right now, whatever its stamp says.
+		FSaveObjectData Scratch;
+		const FSaveObjectData* Data = (Registry && Registry->Contains(Guid)) ? nullptr : Save->PeekObjectByGuid(Guid, Scratch);
+		const int32 Unseen = Data ? SaveReachability::GetSessionsUnseen(*Data, Target.Log) : 0;
+		if (Unseen == INDEX_NONE)
+		{
+			++Stats.Untracked;
+		}
+		else if (Unseen >= StaleRetentionSessions)
+		{
+			Stats.BytesReclaimed += Save->GetEncodedSize(Guid);
+			Save->RemoveObjectByGuid(Guid);
+			++Stats.Pruned;
+			++Target.NumPruned;
+		}
+
+		if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+	Stats.GameThreadMs += ToMs(FPlatformTime::Seconds() - StartSeconds);
+	++Stats.Frames;
+
+	if (!Pass.IsDone())
+	{
+		return true;
+	}
+
+	// The removals are journaled; a full image is what actually gives the bytes back on disk.
+	TSet<int32> ProfilesToSave;
+	for (const FSaveCompactionPass::FTarget& Target : Pass.Targets)
+	{
+		if (USaveSystem* Save = Target.Save.Get(); Save && Target.NumPruned > 0)
+		{
+			Save->bNeedsFullWrite = true;
+			ProfilesToSave.Add(Target.LocalUserNum);
+		}
+	}
+	for (const int32 LocalUserNum : ProfilesToSave)
+	{
+		if (USaveProfileContext* Ctx = FindContext(LocalUserNum))
+		{
+			RequestSave(*Ctx, /*bAsync*/true, ESavePriority::Background);
+		}
+	}
+
+	UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Compaction: %d payloads in %d save objects, %d pruned (%lld bytes reclaimed), %d untracked (%.2fms over %d frames)."),
+		Stats.Checked, Stats.SaveObjects, Stats.Pruned, Stats.BytesReclaimed, Stats.Untracked, Stats.GameThreadMs, Stats.Frames);
+
+	const FSaveCompactionStats Finished = Stats;
+	Pass.Reset();
+	CompactionTickHandle.Reset();
+	OnCompactionFinished.Broadcast(Finished);
+	return false;
+}
+
+/* ---------- Profiles ---------- */
+
+void USaveSystemSubsystem::SwitchProfile(FString NewProfileName, bool bAsync)
+{
+	if (NewProfileName.IsEmpty()) return;
+
+	StopAutosaveTimer();
+	CancelCloudSync();
+
+	USaveProfileContext& Ctx = GetPrimary();
+	if (MountProfile(Ctx, NewProfileName, bAsync))
+	{
+		OnProfileChanged.Broadcast(Ctx.SaveSlotName);
+	}
+	
+	if (bEnableAutoSave)
+	{
+		StartAutosaveTimer();
+	}
+}
+
+bool USaveSystemSubsystem::MountProfile(USaveProfileContext& Ctx, const FString& NewProfileName, bool bAsync)
+{
+	// Two players on one slot would interleave their journals and overwrite each other's images.
+	const FString Slot = SanitizeSlotName(NewProfileName);
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		if (Pair.Value != &Ctx && Pair.Value->SaveSlotName == Slot)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Slot %s is already mounted by local player %d."), *Slot, Pair.Key);
+			return false;
+		}
+	}
+
+	CancelPendingLoad(Ctx);
+
+	// A save mid-gather still targets the old profile's slots.
+	FinishPendingGather(Ctx);
+
+	// Chunks belong to the old profile (written to its slots first); the new one's load on demand.
+	FlushResidentChunks(Ctx);
+
+	Ctx.SaveSlotName = Slot;
+
+	if (SaveSlotStorage::Exists(Ctx.SaveSlotName) && bAsync && GetWorld())
+	{
+		// The index entry is refreshed once the slot has been read.
+		BeginAsyncLoad(Ctx, /*bFromProfileSwitch*/true);
+		if (bPrintDebugOutput)
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loading Save Slot: %s (async, local player %d)"), *Ctx.SaveSlotName, Ctx.LocalUserNum);
+	}
+	else if (SaveSlotStorage::Exists(Ctx.SaveSlotName))
+	{
+		ExecuteLoad(Ctx, false);
+		UpdateProfileIndex(Ctx.SaveSlotName, Ctx.CurrentSaveSystem);
+		if (bPrintDebugOutput)
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Loaded Save Slot: %s (local player %d)"), *Ctx.SaveSlotName, Ctx.LocalUserNum);
+	}
+	else
+	{
+		Ctx.CurrentSaveSystem = Cast<USaveSystem>(UGameplayStatics::CreateSaveGameObject(SaveSystemClass));
+		Ctx.CurrentSaveSystem->SaveVersion = CurrentSaveVersion;
+		WriteSlot(Ctx);
+		if (bPrintDebugOutput)
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Created Save Slot: %s (local player %d)"), *Ctx.SaveSlotName, Ctx.LocalUserNum);
+	}
+	return true;
+}
+
+TArray<FString> USaveSystemSubsystem::GetAvailableProfiles()
+{
+	TArray<FString> Slots;
+	for (const FProfileSlotInfo& Info : GetProfileIndex())
+	{
+		Slots.Add(Info.SlotName);
+	}
+	return Slots;
+}
+
+TArray<FProfileSlotInfo> USaveSystemSubsystem::GetProfileSlotInfos()
+{
+	return GetProfileIndex();
+}
+
+void USaveSystemSubsystem::RebuildProfileIndex()
+{
+	SaveProfileIndex::BuildFromDisk(ProfileIndex);
+	SaveProfileIndex::Save(ProfileIndex);
+	bProfileIndexLoaded = true;
+}
+
+const TArray<FProfileSlotInfo>& USaveSystemSubsystem::GetProfileIndex()
+{
+	if (!bProfileIndexLoaded)
+	{
+		bProfileIndexLoaded = true;
+		if (!SaveProfileIndex::Load(ProfileIndex))
+		{
+			// First run with the index (or it was damaged): one scan of slot files, no slot decoding.
+			RebuildProfileIndex();
+		}
+	}
+	return ProfileIndex;
+}
+
+void USaveSystemSubsystem::UpdateProfileIndex(const FString& Slot, const USaveSystem* SaveObj)
+{
+	if (Slot.IsEmpty() || !SaveObj) return;
+
+	GetProfileIndex();
+
+	const FProfileSlotInfo* Existing = ProfileIndex.FindByPredicate([&Slot](const FProfileSlotInfo& Info) { return Info.SlotName == Slot; });
+	FProfileSlotInfo Info = Existing ? *Existing : SaveProfileIndex::MakeEntry(Slot);
+
+	// Profile meta is a single small object; with index-first slots only it is decoded.
+	FString Field;
+	if (SaveObj->GetField(PROFILE_OBJECT_ID, TEXT("DisplayName"), Field) && !Field.IsEmpty())
+	{
+		Info.DisplayName = Field;
+	}
+	if (SaveObj->GetField(PROFILE_OBJECT_ID, TEXT("PUID"), Field) && !Field.IsEmpty() && Info.Platform == TEXT("Local"))
+	{
+		Info.Platform = TEXT("EOS");
+	}
+	Info.LastSaved = SaveObj->SaveTimestamp.GetTicks() > 0 ? SaveObj->SaveTimestamp : FDateTime::Now();
+	Info.SizeBytes = SaveSlotStorage::GetSize(Slot);
+
+	SaveProfileIndex::Upsert(ProfileIndex, Info);
+	SaveProfileIndex::Save(ProfileIndex);
+}
+
+void USaveSystemSubsystem::AddNewProfile(FString NewProfileName)
+{
+	if (NewProfileName.IsEmpty()) return;
+	if (SaveSlotStorage::Exists(NewProfileName)) return;
+
+	SwitchProfile(NewProfileName);
+}
+
+void USaveSystemSubsystem::DeleteProfile(const FString& ProfileName)
+{
+	if (!ProfileName.IsEmpty() && SaveSlotStorage::Exists(ProfileName))
+	{
+		{
+			for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+			{
+				FinishPendingGather(*Pair.Value);
+				Pair.Value->PendingWriteTask.Wait();
+			}
+			FScopeLock Lock(&SaveJournal::GetSlotLock(ProfileName));
+			SaveSlotStorage::Delete(ProfileName);
+			SaveCloudSync::ClearLastSynced(ProfileName);
+		}
+		if (bPrintDebugOutput)
+		{
+			UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Deleted Save Slot: %s"), *ProfileName);
+		}
+	}
+
+	// Also drops stale entries whose files were removed outside the game.
+	GetProfileIndex();
+	if (!ProfileName.IsEmpty() && SaveProfileIndex::Remove(ProfileIndex, ProfileName))
+	{
+		SaveProfileIndex::Save(ProfileIndex);
+	}
+}
+
+/* ---------- Local players ---------- */
+
+void USaveSystemSubsystem::SwitchProfileForPlayer(int32 LocalUserNum, FString NewProfileName, bool bAsync)
+{
+	if (LocalUserNum <= 0)
+	{
+		SwitchProfile(NewProfileName, bAsync);
+		return;
+	}
+	if (NewProfileName.IsEmpty()) return;
+
+	USaveProfileContext* Ctx = FindContext(LocalUserNum);
+	if (!Ctx)
+	{
+		Ctx = NewObject<USaveProfileContext>(this);
+		Ctx->LocalUserNum = LocalUserNum;
+		Ctx->SaveSlotName.Reset();
+		Contexts.Add(LocalUserNum, Ctx);
+	}
+	if (!MountProfile(*Ctx, NewProfileName, bAsync) && !Ctx->CurrentSaveSystem)
+	{
+		// Never mounted anything: its objects keep saving into the primary profile.
+		Contexts.Remove(LocalUserNum);
+	}
+}
+
+void USaveSystemSubsystem::UnmountPlayer(int32 LocalUserNum)
+{
+	// The primary profile stays mounted for the world.
+	USaveProfileContext* Ctx = LocalUserNum > 0 ? FindContext(LocalUserNum) : nullptr;
+	if (!Ctx) return;
+
+	// Its objects fall back to the primary profile from here on, so they are written to their own one first.
+	SaveScheduler.Cancel(LocalUserNum);
+	ExecuteSave(*Ctx, /*bAsync*/false);
+	Ctx->PendingWriteTask.Wait();
+	FinishChunkFlushes(*Ctx);
+
+	Contexts.Remove(LocalUserNum);
+	if (bPrintDebugOutput)
+	{
+		UE_LOG(LogSaveSystem, Log, TEXT("[SaveSystemSubsystem] Unmounted %s (local player %d)"), *Ctx->SaveSlotName, LocalUserNum);
+	}
+}
+
+void USaveSystemSubsystem::RequestSaveForPlayer(int32 LocalUserNum, bool bAsync, ESavePriority Priority)
+{
+	if (USaveProfileContext* Ctx = FindContext(LocalUserNum))
+	{
+		RequestSave(*Ctx, bAsync, Priority);
+	}
+}
+
+void USaveSystemSubsystem::RequestLoadForPlayer(int32 LocalUserNum, bool bAsync)
+{
+	if (USaveProfileContext* Ctx = FindContext(LocalUserNum))
+	{
+		ExecuteLoad(*Ctx, bAsync);
+	}
+}
+
+USaveSystem* USaveSystemSubsystem::GetSaveSystemForPlayer(int32 LocalUserNum) const
+{
+	const USaveProfileContext* Ctx = FindContext(LocalUserNum);
+	return Ctx ? Ctx->CurrentSaveSystem : GetCurrentSaveSystem();
+}
+
+FString USaveSystemSubsystem::GetSlotNameForPlayer(int32 LocalUserNum) const
+{
+	const USaveProfileContext* Ctx = FindContext(LocalUserNum);
+	return Ctx ? Ctx->SaveSlotName : GetCurrentSlotName();
+}
+
+bool USaveSystemSubsystem::IsLoadInProgressForPlayer(int32 LocalUserNum) const
+{
+	const USaveProfileContext* Ctx = FindContext(LocalUserNum);
+	return Ctx && Ctx->IsLoadInProgress();
+}
+
+/* ---------- Read snapshots ---------- */
+
+FSaveReadSnapshotPtr USaveSystemSubsystem::GetReadSnapshot(int32 LocalUserNum) const
+{
+	const USaveProfileContext* Ctx = FindContext(LocalUserNum);
+	return Ctx ? Ctx->ReadSnapshots->Get() : nullptr;
+}
+
+TSharedPtr<FSaveSnapshotChannel, ESPMode::ThreadSafe> USaveSystemSubsystem::GetSnapshotChannel(int32 LocalUserNum) const
+{
+	const USaveProfileContext* Ctx = FindContext(LocalUserNum);
+	return Ctx ? TSharedPtr<FSaveSnapshotChannel, ESPMode::ThreadSafe>(Ctx->ReadSnapshots) : nullptr;
+}
+
+void USaveSystemSubsystem::PublishReadSnapshots()
+{
+	for (const TPair<int32, USaveProfileContext*>& Pair : Contexts)
+	{
+		if (Pair.Value)
+		{
+			PublishReadSnapshot(*Pair.Value);
+		}
+	}
+}
+
+/* ---------- Cloud ---------- */
+
+void USaveSystemSubsystem::UploadToCloud(bool bForce)
+{
+	StartCloudSync(/*bUpload*/true, bForce);
+}
+
+void USaveSystemSubsystem::DownloadFromCloud(bool bForce)
+{
+	StartCloudSync(/*bUpload*/false, bForce);
+}
+
+void USaveSystemSubsystem::CancelCloudSync()
+{
+	if (CloudSync)
+	{
+		CloudSync->Cancel();
+	}
+}
+
+bool USaveSystemSubsystem::IsCloudSyncInProgress() const
+{
+	return CloudSync.IsValid() && CloudSync->IsRunning();
+}
+
+TSharedPtr<ISaveCloudBackend> USaveSystemSubsystem::MakeCloudBackend() const
+{
+	const ESaveCloudBackend Kind = FParse::Param(FCommandLine::Get(), TEXT("FWSFakeCloud")) ? ESaveCloudBackend::LocalFake : CloudBackend;
+	switch (Kind)
+	{
+	case ESaveCloudBackend::EOS:
+	{
+		EOS_HPlatform Platform = EOSSub ? EOSSub->GetSystem().GetPlatformHandle() : nullptr;
+		EOS_ProductUserId UserId = EOSSub ? EOSSub->GetSystem().GetProductUserId() : nullptr;
+		if (!Platform || !UserId)
+		{
+			UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Cloud sync needs an EOS Connect login."));
+			return nullptr;
+		}
+		return MakeShared<FSaveCloudEOSBackend>(Platform, UserId);
+	}
+
+	case ESaveCloudBackend::LocalFake:
+	{
+		const FString Directory = FakeCloudDirectory.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("FakeCloud") : FakeCloudDirectory;
+		return MakeShared<FSaveCloudFakeBackend>(Directory, FakeCloudLatencyMs, static_cast<int64>(FakeCloudBandwidthKBps) * 1024);
+	}
+
+	default:
+		return nullptr;
+	}
+}
+
+void USaveSystemSubsystem::StartCloudSync(bool bUpload, bool bForce)
+{
+	// Only the primary profile syncs: the backend is the EOS login's user storage.
+	USaveProfileContext& Ctx = GetPrimary();
+	const FString Slot = Ctx.SaveSlotName;
+	if (IsCloudSyncInProgress())
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Cloud sync of %s is already running."), *CloudSync->GetSlot());
+		return;
+	}
+
+	const TSharedPtr<ISaveCloudBackend> Backend = MakeCloudBackend();
+	if (!Backend)
+	{
+		OnCloudSyncFinished.Broadcast(Slot, bUpload, ESaveCloudResult::Unavailable);
+		return;
+	}
+
+	// A save mid-gather lands first, so an upload sends it and a download replaces it.
+	FinishPendingGather(Ctx);
+
+	CloudSync = MakeShared<FSaveCloudSyncOp, ESPMode::ThreadSafe>(Backend.ToSharedRef(), Slot, bUpload, bForce, CloudTransferPartBytes);
+
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	CloudSync->OnProgress = [WeakThis, Slot](int64 BytesTransferred, int64 BytesTotal)
+	{
+		if (USaveSystemSubsystem* Self = WeakThis.Get())
+		{
+			Self->OnCloudSyncProgress.Broadcast(Slot, BytesTransferred, BytesTotal);
+		}
+	};
+	CloudSync->OnFinished = [WeakThis, Slot, bUpload](ESaveCloudResult Result)
+	{
+		if (USaveSystemSubsystem* Self = WeakThis.Get())
+		{
+			Self->OnCloudSyncFinished.Broadcast(Slot, bUpload, Result);
+		}
+	};
+	if (!bUpload)
+	{
+		CloudSync->ApplyFiles = [WeakThis](TArray<SaveCloudSync::FSyncFile>&& Files)
+		{
+			USaveSystemSubsystem* Self = WeakThis.Get();
+			return Self && Self->ApplyCloudDownload(MoveTemp(Files));
+		};
+	}
+
+	// Local files are read after the queued writes have landed.
+	CloudSync->Start(Ctx.PendingWriteTask);
+}
+
+bool USaveSystemSubsystem::ApplyCloudDownload(TArray<SaveCloudSync::FSyncFile>&& Files)
+{
+	USaveProfileContext& Ctx = GetPrimary();
+	const FString& SaveSlotName = Ctx.SaveSlotName;
+	CancelPendingLoad(Ctx);
+	FinishPendingGather(Ctx);
+
+	// Local chunk changes land first, so the download rotates them into the backup generations instead of dropping them.
+	FlushResidentChunks(Ctx);
+	Ctx.PendingWriteTask.Wait();
+	FinishChunkFlushes(Ctx);
+
+	bool bOk = true;
+	{
+		FScopeLock Lock(&SaveJournal::GetSlotLock(SaveSlotName));
+
+		// Chunk slots of levels the cloud copy has no data for stay as they are, backups and journal included.
+		for (const SaveCloudSync::FSyncFile& File : Files)
+		{
+			// The previous image rotates into the backup generations, so a bad download can still be recovered by hand.
+			const FString Slot = SaveSlotName + File.Suffix;
+			if (!SaveSlotStorage::WriteAtomic(Slot, File.Bytes, FMath::Max(BackupGenerations, 1)))
+			{
+				bOk = false;
+				break;
+			}
+			SaveJournal::Discard(Slot);
+		}
+	}
+
+	if (!bOk)
+	{
+		UE_LOG(LogSaveSystem, Warning, TEXT("[SaveSystemSubsystem] Writing the cloud copy of %s failed; reloading what is on disk."), *SaveSlotName);
+	}
+
+	// In-memory objects still hold the replaced state, and chunks streamed in since the flush above were read before the download.
+	Ctx.ResidentChunks.Reset();
+	Ctx.FlushingChunks.Reset();
+	Ctx.FailedChunkFlushes.Reset();
+	ExecuteLoad(Ctx, false);
+	UpdateProfileIndex(SaveSlotName, Ctx.CurrentSaveSystem);
+	return bOk;
+}
+
+/* ---------- Edit Helpers ---------- */
+
+FSaveObjectData* USaveSystemSubsystem::FindOrCreateSaveObject(FName ObjectId)
+{
+	USaveSystem* CurrentSaveSystem = GetCurrentSaveSystem();
+	if (!CurrentSaveSystem) return nullptr;
+	return &CurrentSaveSystem->GetOrCreateObject(ObjectId);
+}
+
+FSaveObjectData USaveSystemSubsystem::FindOrCreateSaveObject_BP(FName ObjectId)
+{
+	// BP copy semantics; edits should be done via EditObjectField to persist
+	USaveSystem* CurrentSaveSystem = GetCurrentSaveSystem();
+	if (!CurrentSaveSystem)
+	{
+		FSaveObjectData Tmp; return Tmp;
+	}
+	return CurrentSaveSystem->GetOrCreateObject(ObjectId);
+}
+
+FGuid USaveSystemSubsystem::GetOrCreateSaveGuid(AActor* Actor)
+{
+	if (!Actor) return FGuid();
+
+	const USaveIdRegistry* Registry = USaveIdRegistry::Get(Actor);
+	USaveIdComponent* Idc = Registry ? Registry->FindComponent(Actor) : Actor->FindComponentByClass<USaveIdComponent>();
+	if (!Idc)
+	{
+		Idc = NewObject<USaveIdComponent>(Actor, USaveIdComponent::StaticClass(), TEXT("SaveIdComponent"));
+		Idc->RegisterComponent();
+	}
+	return Idc->GetOrCreateGuid();
+}
+
+FSaveObjectData* USaveSystemSubsystem::FindOrCreateSaveObjectByGuid(const FGuid& Guid)
+{
+	USaveSystem* CurrentSaveSystem = GetCurrentSaveSystem();
+	if (!CurrentSaveSystem) return nullptr;
+	return &CurrentSaveSystem->GetOrCreateObjectByGuid(Guid);
+}
+
+FSaveObjectData USaveSystemSubsystem::FindOrCreateSaveObjectByGuid_BP(const FGuid& Guid)
+{
+	USaveSystem* CurrentSaveSystem = GetCurrentSaveSystem();
+	if (!CurrentSaveSystem) { FSaveObjectData Tmp; return Tmp; }
+	return CurrentSaveSystem->GetOrCreateObjectByGuid(Guid);
+}
+
+void USaveSystemSubsystem::EditObjectField(FName ObjectId, FName Key, const FString& NewValue, bool bSaveImmediately)
+{
+	USaveProfileContext& Ctx = GetPrimary();
+	if (!Ctx.CurrentSaveSystem) return;
+
+	Ctx.CurrentSaveSystem->SetField(ObjectId, Key, NewValue);
+	PublishReadSnapshot(Ctx);
 
 	if (bSaveImmediately)
 	{
-		RequestSave(true);
+		RequestSave(Ctx, true, ESavePriority::High);
 	}
 }
 
@@ -673,7 +2925,7 @@ void USaveSystemSubsystem::StartAutosaveTimer()
 			[this]()
 			{
 				OnAutosaveTick.Broadcast();
-				RequestSave(true);
+				RequestSave(true, ESavePriority::Background);
 			},
 			AutoSaveIntervalSeconds + GetAutosaveJitter(AutoSaveIntervalSeconds),
 			true
@@ -697,6 +2949,7 @@ void USaveSystemSubsystem::SwitchProfileForIdentity(const FString& DisplayName,
 							  const FString& PUID,
 							  const FString& EAS)
 {
+	USaveSystem* CurrentSaveSystem = GetCurrentSaveSystem();
 	CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, "DisplayName", DisplayName);
 	CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, "PUID", PUID);
 	CurrentSaveSystem->SetField(PROFILE_OBJECT_ID, "EAS", EAS);
@@ -3,21 +3,45 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "TimerManager.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
 #include "SaveSystem.h"
 #include "Saveable.h"
+#include "SaveSlotFormat.h"
+#include "SaveableRegistry.h"
+#include "SaveCloudBackend.h"
+#include "SaveStats.h"
+#include "SaveScheduler.h"
+#include "SaveReachability.h"
+#include "SaveReadSnapshot.h"
+#include "Containers/Ticker.h"
+#include "FWSCore/Shared/FWSTypes.h"
 #include "SaveSystemSubsystem.generated.h"
 
 class UPlayerProfileComponent;
 class UEOSUnifiedSubsystem;
+class ULevel;
+class USaveIdComponent;
+class USaveProfileContext;
+struct FStreamableHandle;
+class FSaveCloudSyncOp;
+namespace SaveCloudSync { struct FSyncFile; }
 /** Delegates */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSaveStarted, FString, SlotName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSaveFinished, FString, SlotName, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLoadFinished, FString, SlotName, bool, bCompleted);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSaveStats, const FSaveStats&, Stats);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRespawnFinished, FString, SlotName, int32, NumSpawned);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCompactionFinished, const FSaveCompactionStats&, Stats);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCloudSyncProgress, FString, SlotName, int64, BytesTransferred, int64, BytesTotal);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCloudSyncFinished, FString, SlotName, bool, bUpload, ESaveCloudResult, Result);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnProfileChanged, FString /* NewSlot */);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAutosaveTick);
 
 /**
- * GameInstance-level Save Manager for a single player profile/slot.
- * Stores per-object fields in USaveSystem and exposes helpers for profile meta.
+ * GameInstance-level Save Manager for the local players' profiles/slots.
+ * Each local player mounts a profile into its own context (USaveProfileContext); player 0's is the primary
+ * profile every unqualified call works on. Stores per-object fields in USaveSystem and exposes helpers for profile meta.
  */
 UCLASS()
 class FWSCORE_API USaveSystemSubsystem : public UGameInstanceSubsystem
@@ -39,9 +63,9 @@ public:
 	void ResolveLoadForAllLocalPlayers(bool bApplyAfterLoad);
 	UPlayerProfileComponent* EnsureProfileComponent(APlayerController* PC) const;
 
-	/** Returns the chosen (sanitized) slot name for this run/user. */
+	/** Returns the chosen (sanitized) slot name of the primary profile. */
 	UFUNCTION(BlueprintPure, Category="Save System")
-	FString GetCurrentSlotName() const { return SaveSlotName; }
+	FString GetCurrentSlotName() const;
 
 	/** Resolve a slot name from currently available identity (EOS, platform, local). No side effects. */
 	FString ResolveSlotName();
@@ -57,24 +81,79 @@ public:
 	/** Convenience overload for actors being destroyed. */
 	void UnregisterSaveable(AActor* DestroyedActor);
 
+	/**
+	 * Called by USaveIdComponent when its actor is destroyed during play. A placed actor leaves a tombstone
+	 * (its payload is replaced by a destroyed marker) in the primary profile; a respawnable one drops its payload.
+	 */
+	void HandleSaveIdDestroyed(const USaveIdComponent& SaveId);
+
 	/* ---------- Public API ---------- */
 
-	/** Request a save; coalesced with a short debounce. */
+	/**
+	 * Marks every mounted profile dirty. The save scheduler merges the requests of each profile and writes it
+	 * in the next window Priority allows (see SaveSettleSeconds, MinSaveIntervalSeconds, MaxSaveDelaySeconds).
+	 */
+	UFUNCTION(BlueprintCallable, Category="Save System")
+	void RequestSave(bool bAsync, ESavePriority Priority = ESavePriority::Normal);
+
+	/** Save every mounted profile right away, bypassing the save scheduler (tools, benchmarks, quit flows). */
 	UFUNCTION(BlueprintCallable, Category="Save System")
-	void RequestSave(bool bAsync);
+	void SaveNow(bool bAsync);
+
+	/** True while an async save's worker write hasn't been acknowledged on the game thread yet (any profile). */
+	UFUNCTION(BlueprintPure, Category="Save System")
+	bool IsSaveInFlight() const;
 
-	/** Request a load from disk into all registered objects. */
+	/** True from an async load's start until OnLoadFinished: reading on a worker or feeding LoadData in slices (any profile). */
+	UFUNCTION(BlueprintPure, Category="Save System")
+	bool IsLoadInProgress() const;
+
+	/** True while actors found missing by the last load are still being respawned (class loads or spawn slices). */
+	UFUNCTION(BlueprintPure, Category="Save System")
+	bool IsRespawnInProgress() const { return PendingRespawn.Items.Num() > 0; }
+
+	/**
+	 * Starts a background pass over every mounted profile (and the chunks of loaded levels) that prunes GUID payloads
+	 * whose actor hasn't been seen for StaleRetentionSessions sessions of its level (see SaveReachability).
+	 * Restarts a running pass. Profiles that lost payloads write a full image next (Background save).
+	 */
+	UFUNCTION(BlueprintCallable, Category="Save System")
+	void CompactSaveData();
+
+	UFUNCTION(BlueprintPure, Category="Save System")
+	bool IsCompactionInProgress() const { return CompactionTickHandle.IsValid(); }
+
+	/** Partition chunks (one per streamed level and profile) currently held in memory. */
+	UFUNCTION(BlueprintPure, Category="Save System")
+	int32 GetNumResidentChunks() const;
+
+	/**
+	 * Request a load from disk of every mounted profile into its registered objects.
+	 * Async: each slot is read and decoded on a worker (profiles in parallel), then applied in LoadBudgetMsPerFrame slices;
+	 * OnLoadFinished fires per slot at the end.
+	 */
 	UFUNCTION(BlueprintCallable, Category="Save System")
 	void RequestLoad(bool bAsync);
 
-	/** Switch the active profile (slot). Loads/creates the new slot. */
+	/**
+	 * Switch the active profile (slot). Loads/creates the new slot.
+	 * Async (menus): returns right away; the previous profile's data stays current until OnLoadFinished.
+	 */
 	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
-	void SwitchProfile(FString NewProfileName);
+	void SwitchProfile(FString NewProfileName, bool bAsync = false);
 
-	/** Enumerate existing save slots discovered by IPlatformFeaturesModule. */
+	/** Enumerate existing save slots (from the profile index, newest first). */
 	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
 	TArray<FString> GetAvailableProfiles();
 
+	/** Per-slot display name, platform, timestamp and size for profile pickers. Never loads a slot. */
+	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
+	TArray<FProfileSlotInfo> GetProfileSlotInfos();
+
+	/** Rescans slot files and rewrites the profile index (e.g. after slots were copied in by hand). */
+	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
+	void RebuildProfileIndex();
+
 	/** Create & switch to a new profile if it doesn't exist. */
 	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
 	void AddNewProfile(FString NewProfileName);
@@ -83,11 +162,83 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
 	void DeleteProfile(const FString& ProfileName);
 
+	/* ---------- Local players ---------- */
+
+	/**
+	 * Mounts a profile for one local player (FSaveProfileKey::LocalUserNum); player 0 is SwitchProfile.
+	 * Other players get a context of their own, so split-screen profiles load and save concurrently.
+	 * Saveables owned by a player's controller (its pawn, player state, components) save into that player's profile;
+	 * everything else stays in the primary one. A slot is mounted by at most one player.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
+	void SwitchProfileForPlayer(int32 LocalUserNum, FString NewProfileName, bool bAsync = true);
+
+	/** Writes out a player's pending changes and drops their context (they left split-screen). Player 0 stays mounted. */
+	UFUNCTION(BlueprintCallable, Category="Save System|Profiles")
+	void UnmountPlayer(int32 LocalUserNum);
+
+	UFUNCTION(BlueprintCallable, Category="Save System")
+	void RequestSaveForPlayer(int32 LocalUserNum, bool bAsync, ESavePriority Priority = ESavePriority::Normal);
+
+	UFUNCTION(BlueprintCallable, Category="Save System")
+	void RequestLoadForPlayer(int32 LocalUserNum, bool bAsync);
+
+	/** Save object of the player's profile; the primary one for players without their own. */
+	UFUNCTION(BlueprintPure, Category="Save System")
+	USaveSystem* GetSaveSystemForPlayer(int32 LocalUserNum) const;
+
+	UFUNCTION(BlueprintPure, Category="Save System")
+	FString GetSlotNameForPlayer(int32 LocalUserNum) const;
+
+	UFUNCTION(BlueprintPure, Category="Save System")
+	bool IsLoadInProgressForPlayer(int32 LocalUserNum) const;
+
+	/** Local player whose controller owns Obj (directly or through its actor's owner chain); 0 for world objects. */
+	static int32 GetSaveableUserNum(const UObject* Obj);
+
+	/* ---------- Read snapshots ---------- */
+
+	/**
+	 * Latest immutable snapshot of a player's profile slot (not its partition chunks), safe to read from any thread
+	 * without locks. Published on every load and save of the slot and by EditObjectField; null before the first.
+	 */
+	FSaveReadSnapshotPtr GetReadSnapshot(int32 LocalUserNum = 0) const;
+
+	/** Where a player's snapshots are published; hold this (not the subsystem) on a worker to pick up newer ones. Null if not mounted. */
+	TSharedPtr<FSaveSnapshotChannel, ESPMode::ThreadSafe> GetSnapshotChannel(int32 LocalUserNum = 0) const;
+
+	/** Publishes a snapshot of every mounted profile now, for edits made through the mutable accessors between saves. */
+	void PublishReadSnapshots();
+
+	/* ---------- Cloud ---------- */
+
+	/**
+	 * Uploads the current profile's slot files as they are on disk (SaveNow first for unsaved changes).
+	 * Only chunks the cloud copy doesn't have are sent. Fails with Conflict if another device uploaded since
+	 * this one last synced, unless bForce.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Save System|Cloud")
+	void UploadToCloud(bool bForce = false);
+
+	/**
+	 * Replaces the current profile's slot files with the cloud copy and reloads it.
+	 * Only chunks no local file has are fetched. Fails with Conflict if this device saved since it last synced, unless bForce.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Save System|Cloud")
+	void DownloadFromCloud(bool bForce = false);
+
+	UFUNCTION(BlueprintCallable, Category="Save System|Cloud")
+	void CancelCloudSync();
+
+	UFUNCTION(BlueprintPure, Category="Save System|Cloud")
+	bool IsCloudSyncInProgress() const;
+
 	/* ---------- Edit Helpers ---------- */
 
 	UFUNCTION(BlueprintPure, Category="Save System|Utilities")
 	static FString SanitizeSlotName(const FString& InRaw);
 
+	/** Mutable access; helpers mark the object dirty, direct edits to Fields/BinaryPayload must call MarkDirty(). */
 	FSaveObjectData* FindOrCreateSaveObject(FName ObjectId);
 	UFUNCTION(BlueprintCallable, Category="Save System|Edit")
 	FSaveObjectData FindOrCreateSaveObject_BP(FName ObjectId);
@@ -109,9 +260,32 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
 	FOnSaveFinished OnSaveFinished;
 
+	/** A load fed every registered object (bCompleted), or was cancelled by a newer load or profile switch. */
+	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
+	FOnLoadFinished OnLoadFinished;
+
 	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
 	FOnAutosaveTick OnAutosaveTick;
 
+	/** Timings, sizes and counts of every finished save and load, per profile (after its worker part has landed). */
+	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
+	FOnSaveStats OnSaveStats;
+
+	/** The actors a primary-profile load found missing have all been respawned (and fed their payloads). */
+	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
+	FOnRespawnFinished OnRespawnFinished;
+
+	/** A compaction pass finished; reports what it pruned and the bytes reclaimed. */
+	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
+	FOnCompactionFinished OnCompactionFinished;
+
+	/** Bytes moved by the running cloud sync, per transfer part. */
+	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
+	FOnCloudSyncProgress OnCloudSyncProgress;
+
+	UPROPERTY(BlueprintAssignable, Category="Save System|Events")
+	FOnCloudSyncFinished OnCloudSyncFinished;
+
 	/** C++ only (avoids UHT bloat) */
 	FOnProfileChanged OnProfileChanged;
 
@@ -120,6 +294,7 @@ public:
 	UPROPERTY(EditAnywhere, Category="Save System|Config")
 	TSubclassOf<USaveSystem> SaveSystemClass = USaveSystem::StaticClass();
 
+	/** Bump when a saveable's payload layout changes and register the upgrade with FSaveMigrationRegistry. */
 	UPROPERTY(EditAnywhere, Category="Save System|Config")
 	int32 CurrentSaveVersion = 1;
 
@@ -129,21 +304,448 @@ public:
 	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(EditCondition="bEnableAutoSave", ClampMin="10.0", UIMin="10.0"))
 	float AutoSaveIntervalSeconds = 180.f;
 
+	/** Normal-priority saves wait until the profile got no new request for this long. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float SaveSettleSeconds = 0.25f;
+
+	/** Shortest time between two scheduled writes (all profiles together); High-priority saves skip it. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float MinSaveIntervalSeconds = 2.f;
+
+	/** A requested save is written at most this long after its first request, however busy the frames are. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float MaxSaveDelaySeconds = 10.f;
+
+	/** Scheduled writes don't start right after a frame longer than this (ms), until MaxSaveDelaySeconds. 0 = off. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float SaveFrameBudgetMs = 50.f;
+
+	/** Saves append only dirty objects to a per-slot journal instead of rewriting the whole image. File-backed slots only (SaveSlotStorage::UsesSlotFiles). */
+	UPROPERTY(EditAnywhere, Category="Save System|Config")
+	bool bEnableSaveJournal = true;
+
+	/** Journal size at which it is folded back into a full image (on the save worker). */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(EditCondition="bEnableSaveJournal", ClampMin="16", UIMin="16"))
+	int32 JournalCompactionThresholdKB = 256;
+
+	/** Previous slot images kept as "<Slot>.sav.1".."N" (rotated by rename) for recovery from a damaged write. File-backed slots only. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0", ClampMax="9", UIMin="0", UIMax="9"))
+	int32 BackupGenerations = 2;
+
+	/** Compression for full slot images. The codec is recorded in the slot header, so loads never need this. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config")
+	ESaveCompressionCodec SlotCompression = ESaveCompressionCodec::None;
+
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(EditCondition="SlotCompression != ESaveCompressionCodec::None"))
+	ESaveCompressionLevel SlotCompressionLevel = ESaveCompressionLevel::Balanced;
+
+	/** RequestLoad(true) spreads LoadData calls over frames with this game-thread budget. 0 = all in one frame. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float LoadBudgetMsPerFrame = 4.f;
+
+	/** Respawning the actors a load found missing spawns them over frames with this game-thread budget. 0 = all in one frame. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float RespawnBudgetMsPerFrame = 2.f;
+
+	/**
+	 * Saveables in streamed sublevels / World Partition cells save into a per-level chunk slot
+	 * ("<Slot>@<Level>") that loads when the level streams in and flushes when it streams out.
+	 * Off = everything lives in the profile slot.
+	 */
+	UPROPERTY(EditAnywhere, Category="Save System|Config")
+	bool bPartitionStreamedLevels = true;
+
+	/** Async saves encode + write on a worker; the game thread only gathers and snapshots. Off = legacy all-GT path. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config")
+	bool bWriteOnWorkerThread = true;
+
+	/**
+	 * Async saves spread SaveData calls over frames with this game-thread budget. 0 = all in one frame.
+	 * Each object is captured once, as of its own slice; changes made after that are picked up by the next save.
+	 */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(EditCondition="bWriteOnWorkerThread", ClampMin="0.0", UIMin="0.0"))
+	float SaveGatherBudgetMsPerFrame = 2.f;
+
+	/** GUID payloads whose actor wasn't seen for this many saved sessions of its level are pruned by compaction. 0 = keep all, no tracking. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0", UIMin="0"))
+	int32 StaleRetentionSessions = 10;
+
+	/** Compaction passes walk payloads with this game-thread budget per frame. 0 = all in one frame. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(EditCondition="StaleRetentionSessions > 0", ClampMin="0.0", UIMin="0.0"))
+	float CompactionBudgetMsPerFrame = 1.f;
+
+	/** Run a compaction pass after every completed load. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(EditCondition="StaleRetentionSessions > 0"))
+	bool bCompactAfterLoad = true;
+
+	/** Saves and loads kept for GetStatsSummary / "FWS.Save.Stats" (each). */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="1", UIMin="1"))
+	int32 StatsHistoryLength = 256;
+
+	/** Service UploadToCloud/DownloadFromCloud use. "-FWSFakeCloud" on the command line forces LocalFake. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config")
+	ESaveCloudBackend CloudBackend = ESaveCloudBackend::EOS;
+
+	/** Largest piece a cloud transfer moves per step (and per progress event). */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="1024", UIMin="1024"))
+	int32 CloudTransferPartBytes = 64 * 1024;
+
+	/** LocalFake: delay before each file operation starts. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0.0", UIMin="0.0"))
+	float FakeCloudLatencyMs = 80.f;
+
+	/** LocalFake: transfer rate in KB/s. 0 = unlimited. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config", meta=(ClampMin="0", UIMin="0"))
+	int32 FakeCloudBandwidthKBps = 512;
+
+	/** LocalFake: store directory. Empty = Saved/FakeCloud. Point two instances at one directory to act as two devices. */
+	UPROPERTY(EditAnywhere, Category="Save System|Config")
+	FString FakeCloudDirectory;
+
+	/** Longest single-frame game-thread time (ms) of the most recent save: a gather slice, or the last one + snapshot; plus encode/write when synchronous. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Save System|State")
+	float LastSaveGameThreadMs = 0.f;
+
+	/** Frames the most recent save's SaveData gather was spread over (1 = not sliced). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Save System|State")
+	int32 LastSaveGatherFrames = 0;
+
+	/** Game-thread time (ms) of the most recent save's gather, summed over its frames. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Save System|State")
+	float LastSaveGatherTotalMs = 0.f;
+
+	/** Bytes the most recent completed save wrote to disk (image or journal record, plus any compaction). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Save System|State")
+	int64 LastSaveBytesWritten = 0;
+
+	/** Longest single-frame game-thread time (ms) of the most recent load (read + resolve + LoadData slices). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Save System|State")
+	float LastLoadGameThreadMs = 0.f;
+
+	/** Percentiles over the last StatsHistoryLength saves or loads. */
+	UFUNCTION(BlueprintPure, Category="Save System|Stats")
+	FSaveStatsSummary GetStatsSummary(ESaveStatsOp Op) const;
+
+	const FSaveStatsHistory& GetStatsHistory(ESaveStatsOp Op) const { return Op == ESaveStatsOp::Save ? SaveStatsHistory : LoadStatsHistory; }
+
+	UFUNCTION(BlueprintCallable, Category="Save System|Stats")
+	void ResetStatsHistory();
+
 	UPROPERTY(VisibleAnywhere, Category="Save System|State")
 	bool bInitialised = false;
 	UEOSUnifiedSubsystem* EOSSub;
 
-	UFUNCTION(BlueprintCallable, Category="Save System|Save") USaveSystem * GetCurrentSaveSystem() const { return CurrentSaveSystem; }
+	/** Save object of the primary profile. */
+	UFUNCTION(BlueprintCallable, Category="Save System|Save") USaveSystem * GetCurrentSaveSystem() const;
 
 protected:
+	friend class USaveProfileContext;
+
+	/* ---------- Contexts ---------- */
+
+	USaveProfileContext& GetPrimary() const;
+	USaveProfileContext* FindContext(int32 LocalUserNum) const;
+
+	/** Context a saveable saves into: its player's if mounted, else the primary one. */
+	USaveProfileContext& GetContextFor(const UObject* Obj) const;
+
+	/** Registered saveables that save into Ctx. */
+	void GatherContextRefs(const USaveProfileContext& Ctx, TArray<FSaveableRef>& OutRefs) const;
+
+	/** Mounts (creating or loading) NewProfileName into Ctx. False if another context has that slot mounted. */
+	bool MountProfile(USaveProfileContext& Ctx, const FString& NewProfileName, bool bAsync);
+
 	/* ---------- Internals ---------- */
 
-	void ExecuteLoad(bool bAsync);
-	void ExecuteSave(bool bAsync);
+	/** Submits a dirty notification for Ctx to the save scheduler. */
+	void RequestSave(USaveProfileContext& Ctx, bool bAsync, ESavePriority Priority);
+
+	/** Starts the write the scheduler picks, if any. Stays registered while writes are pending. */
+	bool TickSaveScheduler(float DeltaTime);
+
+	void ExecuteLoad(USaveProfileContext& Ctx, bool bAsync);
+	void ExecuteSave(USaveProfileContext& Ctx, bool bAsync);
+
+	/** Next slice of a player's time-sliced load (re-armed each frame until done). */
+	void ContinueSlicedLoad(int32 LocalUserNum);
+
+	/** Runs the rest of a pending load now, waiting for its read if needed (before saving, so nothing gathers un-loaded state). */
+	void FinishPendingLoad(USaveProfileContext& Ctx);
+
+	/** Drops a pending load (a new load or profile replaces it) and reports it as not completed. */
+	void CancelPendingLoad(USaveProfileContext& Ctx);
+
+	/** Starts the worker read of the context's slot (and the chunks of loaded levels) for an async load. */
+	void BeginAsyncLoad(USaveProfileContext& Ctx, bool bFromProfileSwitch);
+
+	/** GT: installs the worker's result and starts applying it. */
+	void CompleteAsyncLoad(USaveProfileContext& Ctx, bool bSliced);
+
+	/** GT: feeds the context's save object (and its partition chunks) to its registered objects. */
+	void ApplyLoadedSave(USaveProfileContext& Ctx, bool bSliced, double StartSeconds, TMap<FName, USaveSystem*>&& PrefetchedChunks);
+
+	/** Clears the pending load and broadcasts OnLoadFinished. */
+	void FinishLoad(USaveProfileContext& Ctx);
+	void ResetPendingLoad(USaveProfileContext& Ctx);
+
+	/** Returns true when the slot write succeeded. */
+	bool PerformSaveSync(USaveProfileContext& Ctx);
+	void PerformSaveAsync(USaveProfileContext& Ctx);
+
+	/** Reads the newest intact image of a slot (FWS container or legacy USaveGame). Returns null if none is readable. */
+	USaveSystem* ReadSlot(const FString& Slot, FSaveIoTimings* OutTimings = nullptr) const;
+
+	/** Any thread: ReadSlot's I/O and decode. Legacy USaveGame blobs can only be deserialized on the GT, so they come back as OutLegacyBytes. */
+	static bool ReadSlotSnapshot(const FString& Slot, FSaveSnapshot& OutSnapshot, TArray<uint8>& OutLegacyBytes, FSaveIoTimings* OutTimings = nullptr);
+
+	/** GT: save object for ReadSlotSnapshot's result (null if the legacy blob doesn't deserialize). */
+	USaveSystem* MakeSaveObject(FSaveSnapshot&& Snapshot, const TArray<uint8>& LegacyBytes) const;
+
+	/** Worker output of an async load; the game thread only looks at it once the read is done. */
+	struct FAsyncSlotRead
+	{
+		struct FChunk
+		{
+			FName Partition;
+			bool bFound = false;
+			FSaveSnapshot Snapshot;
+		};
+
+		FString Slot;
+		bool bFromProfileSwitch = false;
+		bool bFound = false;
+		FSaveSnapshot Snapshot;
+		TArray<uint8> LegacyBytes;
+		TArray<FChunk> Chunks;
+
+		/** Launch to worker start (the profile's queued writes). */
+		double QueueWaitSeconds = 0.0;
+		FSaveIoTimings Timings;
+	};
+
+	/** Encodes and writes a full image of the context's save object on the calling (game) thread. */
+	bool WriteSlot(USaveProfileContext& Ctx);
+
+	/** GT: publishes a read snapshot of the context's save object; before any write job clears its dirty flags. */
+	void PublishReadSnapshot(USaveProfileContext& Ctx);
+
+	/** One slot write prepared on the game thread: a full image, a journal delta, or nothing. */
+	struct FSaveWriteJob
+	{
+		FString Slot;
+		/** Save object the job was taken from; only dereferenced on the game thread. */
+		TWeakObjectPtr<USaveSystem> Owner;
+		TSharedPtr<const FSaveSnapshot> Full;
+		TSharedPtr<const FSaveDelta> Delta;
+		/** Owner's FSaveWriteState; updated by the worker as soon as the write finishes. */
+		TSharedPtr<FSaveWriteState, ESPMode::ThreadSafe> WriteState;
+		int64 CompactionThresholdBytes = 0;
+		int32 BackupGenerations = 0;
+		SaveSlotFormat::FEncodeOptions Encode;
+
+		/** Changed payloads and removals captured (all pending ones for a full image). */
+		int32 NumChanges = 0;
+
+		FString Describe() const;
+	};
+
+	/** GT: captures what needs writing and clears the captured dirty state. A full image after any failed write of the slot. */
+	FSaveWriteJob PrepareWriteJob(USaveSystem* SaveObj, const FString& Slot) const;
+
+	/** Any thread: performs the write under the slot I/O lock. Adds its cost to OutTimings; bytes cover images, records and compaction. */
+	static bool RunWriteJob(const FSaveWriteJob& Job, FSaveIoTimings* OutTimings = nullptr);
+
+	/** Worker results of a save's jobs into its stats (the profile slot's job comes first). */
+	static void AddWriteResults(FSaveStats& Stats, TConstArrayView<FSaveWriteJob> Jobs, const FSaveIoTimings& Timings);
+
+	/** GT: stamps, keeps, publishes (stats, CSV) and broadcasts one finished save or load. */
+	void RecordStats(FSaveStats& Stats);
+
+	/** GT: a failed or partial write makes the owner's next save a full image. */
+	static void AcknowledgeWriteJob(const FSaveWriteJob& Job, bool bOk);
+
+	/** Registered objects whose SaveData still has to run for the save being gathered. */
+	struct FSaveGatherBatch
+	{
+		struct FItem
+		{
+			TWeakObjectPtr<UObject> Object;
+			/** INDEX_NONE = profile slot, else index into Partitions. */
+			int32 Target = INDEX_NONE;
+		};
+
+		TArray<FItem> Items;
+		TArray<FName> Partitions;
+		int32 Cursor = 0;
+
+		int32 Frames = 0;
+		double TotalSeconds = 0.0;
+		double MaxFrameSeconds = 0.0;
+		double LastFrameSeconds = 0.0;
+
+		bool IsDone() const { return Cursor >= Items.Num(); }
+		void Reset() { *this = FSaveGatherBatch(); }
+	};
+
+	/** GT: snapshot of what to gather (the context's objects and their partitions); stamps and loads the target chunks. */
+	void BeginGather(USaveProfileContext& Ctx, FSaveGatherBatch& OutBatch);
+
+	/** GT: SaveData for the next objects until the budget runs out (0 = all). Returns true when the batch is done. */
+	bool RunGather(USaveProfileContext& Ctx, FSaveGatherBatch& Batch, double BudgetSeconds);
+
+	/** GT: one job per slot the batch gathered into; the profile slot's job comes first. */
+	void PrepareGatheredJobs(USaveProfileContext& Ctx, const FSaveGatherBatch& Batch, TArray<FSaveWriteJob>& OutJobs);
+
+	/** GT: gathers every object of the context in one go and prepares its jobs. Returns the object count. */
+	int32 GatherAndPrepareJobs(USaveProfileContext& Ctx, TArray<FSaveWriteJob>& OutJobs);
+
+	/** Next slice of a player's async save gather (re-armed each frame until done, then hands off to the worker). */
+	void ContinueSaveGather(int32 LocalUserNum);
+
+	/** Runs the rest of a pending gather now and starts its write (before anything replaces or reads the slot). */
+	void FinishPendingGather(USaveProfileContext& Ctx);
+
+	/** Worker encode + write of the context's finished PendingGather. */
+	void LaunchGatheredWrite(USaveProfileContext& Ctx);
+
+	/* ---------- World state ---------- */
+
+	/** Runtime-spawned actors a load found missing; spawned grouped by class once their classes are loaded. */
+	struct FSaveRespawnBatch
+	{
+		struct FItem
+		{
+			FGuid Guid;
+			FTransform Transform;
+			/** Index into Classes. */
+			int32 Class = 0;
+			/** Save object holding the actor's payload, and the partition / streamed level it goes back into (None = persistent). */
+			TWeakObjectPtr<USaveSystem> Source;
+			FName Partition;
+			TWeakObjectPtr<ULevel> Level;
+		};
+
+		TArray<FItem> Items;
+		TArray<FSoftClassPath> Classes;
+		int32 Cursor = 0;
+		int32 NumSpawned = 0;
+
+		TWeakObjectPtr<UWorld> World;
+		FString Slot;
+
+		/** Keeps the classes loaded until the batch is done; spawning starts when it completes. */
+		TSharedPtr<FStreamableHandle> ClassLoad;
+
+		bool IsDone() const { return Cursor >= Items.Num(); }
+		void Reset() { *this = FSaveRespawnBatch(); }
+	};
+
+	/**
+	 * GT, primary profile: destroys the placed actors of the partition's levels that Save has tombstones for,
+	 * then queues Save's missing runtime-spawned actors for respawn. Runs before the load resolves its payloads.
+	 */
+	void ApplyWorldState(USaveProfileContext& Ctx, USaveSystem& Save, FName Partition);
+
+	/**
+	 * GT, primary profile: writes class and transform of the runtime-spawned respawnable actors (of OnlyLevel, if given)
+	 * into their payloads. Chunk partitions it wrote to are added to OutPartitions.
+	 */
+	void CaptureSpawnRecords(USaveProfileContext& Ctx, const ULevel* OnlyLevel, TArray<FName>* OutPartitions);
 
-	/** Returns true when SaveGameToSlot succeeded. */
-	bool PerformSaveSync();
-	void PerformSaveAsync();
+	/** Sorts the queued respawns by class and starts loading the classes; spawning follows in ContinueRespawn. */
+	void StartRespawn();
+
+	/** Next slice of the respawn (re-armed each frame until done). */
+	void ContinueRespawn();
+
+	/** Drops the queued respawns (a new load replaces them, or the world went away). */
+	void CancelRespawn();
+
+	/* ---------- Compaction ---------- */
+
+	/** GUID payloads of the mounted save objects still to be checked by the running compaction pass. */
+	struct FSaveCompactionPass
+	{
+		struct FTarget
+		{
+			int32 LocalUserNum = 0;
+			TWeakObjectPtr<USaveSystem> Save;
+			FSaveSessionLog Log;
+			TArray<FGuid> Guids;
+			int32 Cursor = 0;
+			int32 NumPruned = 0;
+		};
+
+		TArray<FTarget> Targets;
+		int32 Current = 0;
+		FSaveCompactionStats Stats;
+
+		bool IsDone() const { return Current >= Targets.Num(); }
+		void Reset() { *this = FSaveCompactionPass(); }
+	};
+
+	/**
+	 * GT, at the end of a gather (or a level's flush): counts this session for the loaded levels (OnlyLevel, if given)
+	 * and stamps the payloads of the live SaveId actors in them as seen.
+	 */
+	void TrackReachability(USaveProfileContext& Ctx, const ULevel* OnlyLevel);
+
+	/** Next slice of the compaction pass; unregisters itself when the pass is done. */
+	bool TickCompaction(float DeltaTime);
+
+	/* ---------- Cloud ---------- */
+
+	/** Backend for the configured service; null (and logged) if it can't be used right now. */
+	TSharedPtr<ISaveCloudBackend> MakeCloudBackend() const;
+
+	void StartCloudSync(bool bUpload, bool bForce);
+
+	/** GT: writes downloaded slot files in place of the current profile's and reloads it. */
+	bool ApplyCloudDownload(TArray<SaveCloudSync::FSyncFile>&& Files);
+
+	/* ---------- Level partitions ---------- */
+
+	/** Partition of a level: its package name for streamed levels, NAME_None for the persistent level (profile slot). */
+	FName GetLevelPartition(const ULevel* Level) const;
+
+	/** Partition of the actor that owns Obj (NAME_None for non-actors). */
+	FName GetSavePartition(const UObject* Obj) const;
+
+	/** Splits the context's saveables into profile-slot refs and per-partition refs. */
+	void GatherRefsByPartition(const USaveProfileContext& Ctx, TArray<FSaveableRef>& OutMain, TMap<FName, TArray<FSaveableRef>>& OutChunks) const;
+
+	/** Resident chunk of a partition; read from disk (or created empty) on first use. */
+	USaveSystem* FindOrLoadChunk(USaveProfileContext& Ctx, FName Partition);
+
+	/** Moves payloads that older saves kept in the profile slot into the chunk that now owns them. */
+	void MigrateToChunk(USaveProfileContext& Ctx, USaveSystem& Chunk, TConstArrayView<FSaveableRef> Refs);
+
+	/** Loads a partition's chunk and feeds LoadData of its objects in one go. */
+	void ApplyChunk(USaveProfileContext& Ctx, FName Partition, TConstArrayView<FSaveableRef> Refs);
+
+	void HandleLevelAdded(ULevel* Level, UWorld* World);
+	void HandleLevelRemoved(ULevel* Level, UWorld* World);
+
+	/** GT: writes a streamed-out chunk on the worker, holding it in FlushingChunks until OnChunkFlushed. */
+	void FlushChunk(USaveProfileContext& Ctx, const FString& ChunkSlot, USaveSystem* Chunk);
+
+	/** GT: flushes every resident chunk with unsaved changes and empties ResidentChunks (profile switch, reload). */
+	void FlushResidentChunks(USaveProfileContext& Ctx);
+
+	/** GT: releases a flushed chunk, or keeps a failed one for a retry with the next save. */
+	void OnChunkFlushed(USaveProfileContext& Ctx, const FSaveWriteJob& Job, bool bOk);
+
+	/** GT: starts another flush of every chunk whose previous one failed. */
+	void RetryFailedChunkFlushes(USaveProfileContext& Ctx);
+
+	/** GT, once the context's writes have been waited for (unmount, shutdown): rewrites failed chunks synchronously, one last time. */
+	void FinishChunkFlushes(USaveProfileContext& Ctx);
+
+	/** Profile index cache; loaded (or rebuilt from disk) on first use. */
+	const TArray<FProfileSlotInfo>& GetProfileIndex();
+
+	/** Refreshes a slot's index entry after a save/switch and persists the index. */
+	void UpdateProfileIndex(const FString& Slot, const USaveSystem* SaveObj);
 
 	/** Autosave */
 	void StartAutosaveTimer();
@@ -153,30 +755,48 @@ protected:
 	void SwitchProfileForIdentity(const FString& DisplayName, const FString& PUID, const FString& EAS);
 
 private:
-	/** In-memory save object for the active slot. */
-	UPROPERTY(Transient)
-	USaveSystem* CurrentSaveSystem = nullptr;
-
-	/** Current active slot name. */
-	UPROPERTY(VisibleAnywhere, Category="Save System|State")
-	FString SaveSlotName = TEXT("DefaultSaveSlot");
-	
-	/** Registered saveables we will query on save/load. */
+	/** Mounted profiles by LocalUserNum; 0 (the primary profile) exists from Initialize to Deinitialize. */
 	UPROPERTY(Transient)
-	TArray<TWeakObjectPtr<UObject>> RegisteredSaveables;
+	TMap<int32, USaveProfileContext*> Contexts;
 
-	/** Small debounce for spammy RequestSave calls. */
-	FTimerHandle DebouncedSaveHandle;
+	/** Registered saveables we will query on save/load (SaveId component cached at registration). */
+	FSaveableRegistry RegisteredSaveables;
 
 	/** Autosave recurring timer. */
 	FTimerHandle AutosaveTimerHandle;
 
-	/** Pending flag used by debounce. */
-	bool bSavePending = false;
+	/** When each profile's requested saves are written; ticked by SaveSchedulerTickHandle. */
+	FSaveScheduler SaveScheduler;
+	FTSTicker::FDelegateHandle SaveSchedulerTickHandle;
+
+	/** Running (or last) cloud upload/download of the primary profile (the EOS-logged-in user's). */
+	TSharedPtr<FSaveCloudSyncOp, ESPMode::ThreadSafe> CloudSync;
 
-	/** Prevent overlapping async saves. */
-	bool bSaveInFlight = false;
+	/** GetLevelPartition results; building the name per object per save would dominate the gather. */
+	mutable TMap<TObjectKey<ULevel>, FName> LevelPartitionCache;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
 
 	/** Optional verbose logging. */
 	bool bPrintDebugOutput = false;
+
+	/** Respawns queued by the primary profile's loads and level chunks. */
+	FSaveRespawnBatch PendingRespawn;
+	FTimerHandle RespawnSliceHandle;
+
+	/** Running compaction pass; ticked by CompactionTickHandle while it lasts. */
+	FSaveCompactionPass Compaction;
+	FTSTicker::FDelegateHandle CompactionTickHandle;
+
+	/** Set while loads destroy tombstoned actors, so their destruction isn't recorded again. */
+	bool bApplyingWorldState = false;
+
+	/** Recent saves and loads (see StatsHistoryLength). */
+	FSaveStatsHistory SaveStatsHistory;
+	FSaveStatsHistory LoadStatsHistory;
+
+	/** Mirror of Profiles.index (see SaveProfileIndex). */
+	TArray<FProfileSlotInfo> ProfileIndex;
+	bool bProfileIndexLoaded = false;
 };
@@ -1,5 +1,103 @@
 ﻿// Saveable.cpp
 #include "Saveable.h"
 #include "SaveSystem.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
 
+namespace
+{
+	/** Where ISaveable sits in instances of a class, per event; INDEX_NONE = call through reflection. */
+	struct FDispatchEntry
+	{
+		int32 SaveOffset = INDEX_NONE;
+		int32 LoadOffset = INDEX_NONE;
+	};
 
+	TMap<TObjectKey<UClass>, FDispatchEntry> GDispatchCache;
+
+	bool GNativeDispatch = true;
+	FAutoConsoleVariableRef CVarNativeDispatch(
+		TEXT("FWS.Save.NativeDispatch"),
+		GNativeDispatch,
+		TEXT("Call C++ SaveData/LoadData implementations directly instead of through ProcessEvent (0 = always reflect)."));
+
+	/** True if a Blueprint class between Class and its native base implements or overrides the event. */
+	bool IsBlueprintEvent(const UClass* Class, FName EventName)
+	{
+		for (const UClass* C = Class; C && !C->HasAnyClassFlags(CLASS_Native); C = C->GetSuperClass())
+		{
+			if (C->FindFunctionByName(EventName, EIncludeSuperFlag::ExcludeSuper))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	const FDispatchEntry& FindEntry(UObject* Obj)
+	{
+		UClass* Class = Obj->GetClass();
+		if (const FDispatchEntry* Found = GDispatchCache.Find(Class))
+		{
+			return *Found;
+		}
+
+		// Null when the interface is only implemented in Blueprint.
+		FDispatchEntry Entry;
+		if (const void* Native = Obj->GetNativeInterfaceAddress(USaveable::StaticClass()))
+		{
+			const int32 Offset = static_cast<int32>(static_cast<const uint8*>(Native) - reinterpret_cast<const uint8*>(Obj));
+			Entry.SaveOffset = IsBlueprintEvent(Class, GET_FUNCTION_NAME_CHECKED(ISaveable, SaveData)) ? INDEX_NONE : Offset;
+			Entry.LoadOffset = IsBlueprintEvent(Class, GET_FUNCTION_NAME_CHECKED(ISaveable, LoadData)) ? INDEX_NONE : Offset;
+		}
+		return GDispatchCache.Add(Class, Entry);
+	}
+
+	ISaveable* AtOffset(UObject* Obj, int32 Offset)
+	{
+		return reinterpret_cast<ISaveable*>(reinterpret_cast<uint8*>(Obj) + Offset);
+	}
+}
+
+void FSaveableDispatch::SaveData(UObject* Obj, USaveSystem* SaveSystem)
+{
+	if (GNativeDispatch)
+	{
+		if (const int32 Offset = FindEntry(Obj).SaveOffset; Offset != INDEX_NONE)
+		{
+			AtOffset(Obj, Offset)->SaveData_Implementation(SaveSystem);
+			return;
+		}
+	}
+	ISaveable::Execute_SaveData(Obj, SaveSystem);
+}
+
+void FSaveableDispatch::LoadData(UObject* Obj, USaveSystem* SaveSystem, const FSaveObjectData& Value)
+{
+	if (GNativeDispatch)
+	{
+		if (const int32 Offset = FindEntry(Obj).LoadOffset; Offset != INDEX_NONE)
+		{
+			AtOffset(Obj, Offset)->LoadData_Implementation(SaveSystem, Value);
+			return;
+		}
+	}
+	ISaveable::Execute_LoadData(Obj, SaveSystem, Value);
+}
+
+bool FSaveableDispatch::IsNative(UObject* Obj)
+{
+	if (!GNativeDispatch || !Obj) return false;
+	const FDispatchEntry& Entry = FindEntry(Obj);
+	return Entry.SaveOffset != INDEX_NONE && Entry.LoadOffset != INDEX_NONE;
+}
+
+bool FSaveableDispatch::IsEnabled()
+{
+	return GNativeDispatch;
+}
+
+void FSaveableDispatch::SetEnabled(bool bEnabled)
+{
+	GNativeDispatch = bEnabled;
+}
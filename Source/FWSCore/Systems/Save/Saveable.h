@@ -4,6 +4,9 @@
 #include "UObject/Interface.h"
 #include "Saveable.generated.h"
 
+class USaveSystem;
+struct FSaveObjectData;
+
 /**
  * Implement on any UObject that wants to participate in the SaveSystem.
  * Preferred: for Actors, store/load via GUID with USaveIdComponent.
@@ -24,3 +27,21 @@ public:
 	/** Called by the save system to apply previously saved data (const-ref to avoid copies). */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Load")	void LoadData(USaveSystem* SaveSystem, const FSaveObjectData& Value);
 };
+
+/**
+ * Calls ISaveable's events the cheapest way a class allows. C++ implementations are called directly through
+ * ISaveable's vtable; Blueprint implementations, and Blueprint subclasses overriding an event, go through
+ * Execute_* (ProcessEvent). Decided once per class and event. Game thread only.
+ * "FWS.Save.NativeDispatch 0" sends every call through reflection.
+ */
+struct FWSCORE_API FSaveableDispatch
+{
+	static void SaveData(UObject* Obj, USaveSystem* SaveSystem);
+	static void LoadData(UObject* Obj, USaveSystem* SaveSystem, const FSaveObjectData& Value);
+
+	/** True if both events of Obj's class are called directly (while enabled). */
+	static bool IsNative(UObject* Obj);
+
+	static bool IsEnabled();
+	static void SetEnabled(bool bEnabled);
+};
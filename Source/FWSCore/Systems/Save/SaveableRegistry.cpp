@@ -0,0 +1,150 @@
+﻿#include "SaveableRegistry.h"
+
+int32 FSaveableRegistry::FindSlot(int32 ObjectIndex) const
+{
+	const int32 Page = ObjectIndex >> PageBits;
+	if (!Pages.IsValidIndex(Page) || !Pages[Page]) return INDEX_NONE;
+	return Pages[Page][ObjectIndex & (PageSize - 1)];
+}
+
+void FSaveableRegistry::SetSlot(int32 ObjectIndex, int32 Slot)
+{
+	const int32 Page = ObjectIndex >> PageBits;
+	if (Page >= Pages.Num())
+	{
+		Pages.SetNum(Page + 1);
+	}
+	if (!Pages[Page])
+	{
+		Pages[Page] = MakeUnique<int32[]>(PageSize);
+		for (int32 i = 0; i < PageSize; ++i)
+		{
+			Pages[Page][i] = INDEX_NONE;
+		}
+	}
+	Pages[Page][ObjectIndex & (PageSize - 1)] = Slot;
+}
+
+bool FSaveableRegistry::Add(UObject* Obj)
+{
+	if (!Obj) return false;
+
+	const int32 ObjectIndex = static_cast<int32>(Obj->GetUniqueID());
+	const int32 Existing = FindSlot(ObjectIndex);
+	if (Existing != INDEX_NONE)
+	{
+		if (Dense[Existing].Object.Get() == Obj)
+		{
+			return false;
+		}
+		// The index was recycled from an object that died while registered.
+		RemoveAtSlot(Existing);
+	}
+
+	SetSlot(ObjectIndex, Dense.Num());
+	Dense.Add(FSaveableRef::Make(Obj));
+	DenseObjectIndex.Add(ObjectIndex);
+	++NumLive;
+
+	Compact(StepsPerMutation);
+	return true;
+}
+
+bool FSaveableRegistry::Remove(const UObject* Obj)
+{
+	if (!Obj) return false;
+
+	const int32 Slot = FindSlot(static_cast<int32>(Obj->GetUniqueID()));
+	if (Slot == INDEX_NONE || Dense[Slot].Object.Get() != Obj)
+	{
+		return false;
+	}
+
+	RemoveAtSlot(Slot);
+	Compact(StepsPerMutation);
+	return true;
+}
+
+bool FSaveableRegistry::Contains(const UObject* Obj) const
+{
+	if (!Obj) return false;
+	const int32 Slot = FindSlot(static_cast<int32>(Obj->GetUniqueID()));
+	return Slot != INDEX_NONE && Dense[Slot].Object.Get() == Obj;
+}
+
+void FSaveableRegistry::RemoveAtSlot(int32 Slot)
+{
+	SetSlot(DenseObjectIndex[Slot], INDEX_NONE);
+	Dense[Slot] = FSaveableRef();
+	DenseObjectIndex[Slot] = INDEX_NONE;
+	--NumLive;
+}
+
+void FSaveableRegistry::Reset()
+{
+	Pages.Reset();
+	Dense.Reset();
+	DenseObjectIndex.Reset();
+	NumLive = 0;
+	CompactRead = CompactWrite = 0;
+}
+
+void FSaveableRegistry::Compact(int32 MaxSteps)
+{
+	if (Dense.Num() == NumLive && CompactRead == 0)
+	{
+		return;
+	}
+
+	int32 Steps = 0;
+	while (CompactRead < Dense.Num() && (MaxSteps <= 0 || Steps++ < MaxSteps))
+	{
+		const int32 Read = CompactRead++;
+		const int32 ObjectIndex = DenseObjectIndex[Read];
+		if (ObjectIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		if (!Dense[Read].Object.Get())
+		{
+			// Destroyed/collected without UnregisterSaveable.
+			RemoveAtSlot(Read);
+			continue;
+		}
+
+		const int32 Write = CompactWrite++;
+		if (Write != Read)
+		{
+			Dense[Write] = MoveTemp(Dense[Read]);
+			DenseObjectIndex[Write] = ObjectIndex;
+			Dense[Read] = FSaveableRef();
+			DenseObjectIndex[Read] = INDEX_NONE;
+			SetSlot(ObjectIndex, Write);
+		}
+	}
+
+	if (CompactRead >= Dense.Num())
+	{
+		Dense.SetNum(CompactWrite, EAllowShrinking::No);
+		DenseObjectIndex.SetNum(CompactWrite, EAllowShrinking::No);
+		CompactRead = CompactWrite = 0;
+	}
+}
+
+void FSaveableRegistry::GatherObjects(TArray<UObject*>& Out)
+{
+	Compact();
+
+	Out.Reserve(Out.Num() + NumLive);
+	for (int32 Slot = 0; Slot < Dense.Num(); ++Slot)
+	{
+		if (UObject* Obj = Dense[Slot].Object.Get())
+		{
+			Out.Add(Obj);
+		}
+		else if (DenseObjectIndex[Slot] != INDEX_NONE)
+		{
+			RemoveAtSlot(Slot);
+		}
+	}
+}
@@ -0,0 +1,58 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSystem.h"
+
+/**
+ * Registered saveables as a sparse set keyed by the UObject internal index.
+ * Add/Remove/Contains are O(1); iteration is over a dense array in registration order.
+ * Removal leaves a hole that an order-preserving compaction fills a few entries at a time,
+ * and entries whose object died without unregistering are dropped along the way.
+ */
+class FWSCORE_API FSaveableRegistry
+{
+public:
+	/** False if Obj is already registered. */
+	bool Add(UObject* Obj);
+
+	/** False if Obj wasn't registered. */
+	bool Remove(const UObject* Obj);
+
+	bool Contains(const UObject* Obj) const;
+
+	int32 Num() const { return NumLive; }
+	bool IsEmpty() const { return NumLive == 0; }
+	void Reset();
+
+	/** Dense entries in registration order. Holes have a null Object; callers skip them. */
+	TConstArrayView<FSaveableRef> GetRefs() const { return Dense; }
+
+	/** Appends every live object in registration order; finishes any pending compaction first. */
+	void GatherObjects(TArray<UObject*>& Out);
+
+	/** Moves up to MaxSteps entries towards the front (0 = finish). No-op without holes. */
+	void Compact(int32 MaxSteps = 0);
+
+private:
+	static constexpr int32 PageBits = 10;
+	static constexpr int32 PageSize = 1 << PageBits;
+
+	/** Compaction work done by each Add/Remove, so holes never pile up between saves. */
+	static constexpr int32 StepsPerMutation = 8;
+
+	int32 FindSlot(int32 ObjectIndex) const;
+	void SetSlot(int32 ObjectIndex, int32 Slot);
+	void RemoveAtSlot(int32 Slot);
+
+	/** Object index -> dense slot (INDEX_NONE when absent), allocated a page at a time. */
+	TArray<TUniquePtr<int32[]>> Pages;
+
+	TArray<FSaveableRef> Dense;
+	TArray<int32> DenseObjectIndex; // INDEX_NONE marks a hole
+
+	int32 NumLive = 0;
+
+	/** Compaction progress: [0, Write) is packed, [Write, Read) are holes, [Read, Num) untouched. */
+	int32 CompactRead = 0;
+	int32 CompactWrite = 0;
+};
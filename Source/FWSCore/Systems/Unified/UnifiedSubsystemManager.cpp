@@ -382,7 +382,7 @@ bool UUnifiedSubsystemManager::UpdateApplySaveSettings(const FPlayerSettings& Ne
 	// Persist if requested (async by default)
 	if (bSave && Save)
 	{
-		Save->RequestSave(/*bAsync*/true);
+		Save->RequestSave(/*bAsync*/true, ESavePriority::High);
 	}
 	return true;
 }